@@ -14,15 +14,42 @@
 #define _SMARTOPTIONS_H
 
 /* C Headers */
+#include <ctype.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 /* C++ Headers */
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
 #include <iostream>
 #include <fstream>
+#include <bitset>
+#include <iterator>
 #include <list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
 
 /** @cond INTERNAL */
 // Macros
@@ -107,14 +134,11 @@ struct SmartOptionsArg {
      *
      * @param prefixShort A single character used to specify the option in POSIX style
      * @param prefixLong A string used to specify the option in GNU style.
-     * @param metaVariable A string which specifies the different option values.
-     * @param helpString A string which explains the option in context.
      */
-    SmartOptionsArg(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString)
+    SmartOptionsArg(char prefixShort, const char *prefixLong)
     : prefixShort(prefixShort),
       prefixLong(prefixLong),
-      metaVariable(metaVariable),
-      helpString(helpString)
+      id(0)
     {
     }
 
@@ -126,8 +150,7 @@ struct SmartOptionsArg {
     // Member Variables
     char prefixShort;       //!< @brief A single character used to specify the option, POSIX style.
     const char *prefixLong;     //!< @brief The string used to specify the option, GNU style.
-    const char *metaVariable;   //!< @brief The string which specifies the different option values.
-    const char *helpString;     //!< @brief The string which explains the option in context.
+    unsigned id;                //!< @brief The option ID, assigned in the order in which the options are added.
 };
 
 /*
@@ -144,12 +167,10 @@ struct SmartOptionsOptionArg: public SmartOptionsArg {
      *
      * @param prefixShort A single character used to specify the option in POSIX style
      * @param prefixLong A string used to specify the option in GNU style.
-     * @param metaVariable A string which specifies the different option values.
-     * @param helpString A string which explains the option in context.
      * @param destVariable A pointer, where the retrieved value is stored into.
      */
-    SmartOptionsOptionArg(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString, const char **destVariable) 
-    : SmartOptionsArg(prefixShort, prefixLong, metaVariable, helpString) {
+    SmartOptionsOptionArg(char prefixShort, const char *prefixLong, const char **destVariable) 
+    : SmartOptionsArg(prefixShort, prefixLong) {
        // Initialize the derived class members...
         this->destVariable  = destVariable;
         (*this->destVariable) = NULL;
@@ -159,7 +180,7 @@ struct SmartOptionsOptionArg: public SmartOptionsArg {
     const char **destVariable;        //!< @brief A pointer, where the retrieved value is stored into.
 };
 
-typedef std::list<SmartOptionsOptionArg> SmartOptionsOptionArgList;
+typedef std::pmr::list<SmartOptionsOptionArg> SmartOptionsOptionArgList;
 
 /**
  * @brief The class which holds the Flag Command line parameter.
@@ -170,11 +191,10 @@ struct SmartOptionsFlagArg : public SmartOptionsArg {
      *
      * @param prefixShort A single character used to specify the option in POSIX style
      * @param prefixLong A string used to specify the option in GNU style.
-     * @param helpString A string which explains the option in context.
      * @param destVariable A pointer, where the retrieved value is stored into.
      */
-    SmartOptionsFlagArg(char prefixShort, const char *prefixLong, const char *helpString, bool *destVariable) 
-    : SmartOptionsArg(prefixShort, prefixLong, metaVariable, helpString) {
+    SmartOptionsFlagArg(char prefixShort, const char *prefixLong, bool *destVariable) 
+    : SmartOptionsArg(prefixShort, prefixLong) {
         // Initialize the derived class members...
         this->destVariable = destVariable;
         (*this->destVariable) = false;
@@ -184,7 +204,7 @@ struct SmartOptionsFlagArg : public SmartOptionsArg {
     bool *destVariable;       //!< @brief A pointer, where the retrieved value is stored into.
 };
 
-typedef std::list<SmartOptionsFlagArg> SmartOptionsFlagArgList;
+typedef std::pmr::list<SmartOptionsFlagArg> SmartOptionsFlagArgList;
 
 /**
  * @brief The class which holds the Positional Command line parameter.
@@ -193,12 +213,10 @@ struct SmartOptionsPositionalArg : public SmartOptionsArg {
     /**
      * @brief The Constructor.
      *
-     * @param metaVariable A string which specifies the different option values.
-     * @param helpString A string which explains the option in context.
      * @param destVariable A pointer, where the retrieved value is stored into.
      */
-    SmartOptionsPositionalArg(const char *metaVariable, const char *helpString, const char **destVariable) 
-    : SmartOptionsArg(0, NULL, metaVariable, helpString) {
+    SmartOptionsPositionalArg(const char **destVariable) 
+    : SmartOptionsArg(0, NULL) {
         // Initialize the derived class members...
         this->destVariable = destVariable;
     }
@@ -207,7 +225,7 @@ struct SmartOptionsPositionalArg : public SmartOptionsArg {
     const char **destVariable;        //!< @brief A pointer, where the retrieved value is stored into.
 };
 
-typedef std::vector<SmartOptionsPositionalArg> SmartOptionsPositionalArgList;
+typedef std::pmr::vector<SmartOptionsPositionalArg> SmartOptionsPositionalArgList;
 
 /** @endcond */
 
@@ -218,289 +236,5435 @@ typedef enum SMARTOPTIONS_STATUS {
    SMARTOPTIONS_SUCCESS             = 0x00,  /*!< Returned when we are able to successfully parse the command line without any issues. */
    SMARTOPTIONS_INVALID_ARGUMENT,            /*!< Returned when we have invalid command line parameters passed to the program. */
    SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS,  /*!< Returned when the number of command line parameters is not as per the usage guidelines. */
-   SMARTOPTIONS_SYSTEM_ERROR                 /*!< Returned when there is a system error like malloc failure... Check errno in such cases... */
+   SMARTOPTIONS_SYSTEM_ERROR,                /*!< Returned when there is a system error like malloc failure... Check errno in such cases... */
+   SMARTOPTIONS_INVALID_FORMAT,              /*!< Returned when the value of a typed option is not in the expected format, like 1.5x for a number. */
+   SMARTOPTIONS_OUT_OF_RANGE                 /*!< Returned when the value of a typed option can not be represented by its type, like 1e999 for a double. */
 } SMARTOPTIONS_STATUS;
 
+/** @cond INTERNAL */
+
 /**
- * @brief SmartOptions, the next generation of Command Line Parameter processing library.
- * @details SmartOptions is used for processing command line parameters. It has been inspired by
- * the command line processing in Python.
+ * @brief Hashes a string (64 bit FNV-1a).
+ *
+ * @param str The string to be hashed.
+ * @param length The number of characters to be hashed.
+ *
+ * @returns The hash of the string.
  */
-class SmartOptions {
-public: // Public Member Functions...
-    /**
-     * @brief The Constructor
-     * @param programName The name of the program to be used while printing auto help...
-     * @param autoPrintHelp Prints the help message automatically by using the available data.
-     */
-    SmartOptions(const char *programName, bool autoPrintHelp) {
-        this->argC = 0;
-        this->argV = NULL;
+inline constexpr uint64_t SmartOptionsHashString(const char *str, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)str[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
 
-        this->appName = programName;
-        this->usage = NULL;
-        this->description = NULL;
-        this->autoPrintHelp = autoPrintHelp;
+/**
+ * @brief Returns the length of a NUL terminated string, usable in constant expressions.
+ */
+inline constexpr size_t SmartOptionsStringLength(const char *str) {
+    size_t length = 0;
+    while (str[length]) {
+        length++;
     }
+    return length;
+}
 
-    /**
-     * @brief Sets the description string for the current program.
-     *
-     * @param description The description string for the current program.
-     */
-    void AddDescription(const char *description) {
-        this->description = description;
+/**
+ * @brief Derives a well distributed 32 bit value from a string hash and a seed, used to select
+ * buckets and slots in the perfect hash tables.
+ *
+ * @param hash The hash returned by SmartOptionsHashString().
+ * @param seed The seed (displacement) to be mixed into the hash.
+ *
+ * @returns The mixed value.
+ */
+inline constexpr uint32_t SmartOptionsHashMix(uint64_t hash, uint32_t seed) {
+    hash ^= (uint64_t)seed * 0x9e3779b97f4a7c15ull;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return (uint32_t)hash;
+}
+
+/**
+ * @brief Scrambles a 64 bit value, so that every input bit affects every output bit (MurmurHash3 finalizer).
+ */
+inline constexpr uint64_t SmartOptionsHashFinalize(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non zero value.
+ */
+inline unsigned SmartOptionsLowestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(value);
+#else
+    unsigned index = 0;
+    while (0 == (value & 1)) {
+        value >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Compares a NUL terminated string with a string of the given length, usable in constant expressions.
+ */
+inline constexpr bool SmartOptionsStringEquals(const char *lhs, const char *rhs, size_t rhsLength) {
+    for (size_t i = 0; i < rhsLength; i++) {
+        if (lhs[i] != rhs[i]) return false;   // Also stops at the end of lhs, as rhs holds no NUL...
+    }
+    return '\0' == lhs[rhsLength];
+}
+
+/**
+ * @brief Returns the smallest power of two which is greater than or equal to the given value.
+ */
+inline constexpr size_t SmartOptionsNextPow2(size_t value) {
+    size_t pow2 = 1;
+    while (pow2 < value) {
+        pow2 <<= 1;
     }
+    return pow2;
+}
+
+/** @endcond */
+
+/**
+ * @brief A single entry of a choice list, mapping a word to its integral (enum) value.
+ */
+template <typename E>
+struct SmartOptionsChoice {
+    const char *name;   //!< @brief The word accepted on the command line.
+    E value;            //!< @brief The value stored into the destination variable for the word.
+};
+
+/**
+ * @brief A fixed set of words accepted by an enum option, looked up through a perfect hash.
+ *
+ * @details The perfect hash (hash and displace) is built by the constructor. When the table is declared
+ * constexpr, the hash is generated by the compiler and a lookup at run time costs one pass over the value,
+ * two table reads and one string compare.
+ *
+ * @code
+    enum Mode { MODE_FAST, MODE_SAFE, MODE_PARANOID };
 
+    static constexpr SmartOptionsChoice<Mode> modeChoices[] = {
+        { "fast", MODE_FAST }, { "safe", MODE_SAFE }, { "paranoid", MODE_PARANOID }
+    };
+    static constexpr auto modes = SmartOptionsMakeChoices(modeChoices);
+
+    Mode mode = MODE_SAFE;
+    smartOptions.AddEnumOption('m', "mode", "MODE", "Processing mode.", modes, &mode);
+   @endcode
+ */
+template <typename E, size_t N>
+class SmartOptionsChoices {
+public:
     /**
-     * @brief Sets the usage string for the current program.
+     * @brief The Constructor, generates the perfect hash for the given choices.
      *
-     * @param usage The usage string for the current program.
+     * @param choices The words accepted and their values. The strings must outlive the table.
      */
-    void AddUsage(const char *usage ) {
-        this->usage = usage;
+    constexpr SmartOptionsChoices(const SmartOptionsChoice<E> (&choices)[N])
+    : choices(),
+      slots(),
+      displacements(),
+      perfect(true)
+    {
+        uint64_t hashes[N] = {};
+        size_t bucketSizes[BUCKET_COUNT] = {};
+        size_t bucketOrder[BUCKET_COUNT] = {};
+
+        for (size_t i = 0; i < N; i++) {
+            this->choices[i] = choices[i];
+            hashes[i] = SmartOptionsHashString(choices[i].name, SmartOptionsStringLength(choices[i].name));
+            bucketSizes[SmartOptionsHashMix(hashes[i], 0) % BUCKET_COUNT]++;
+        }
+        for (size_t i = 0; i < SLOT_COUNT; i++) {
+            this->slots[i] = EMPTY_SLOT;
+        }
+
+        // Place the largest buckets first, they are the hardest to displace...
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            bucketOrder[i] = i;
+        }
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            for (size_t j = i + 1; j < BUCKET_COUNT; j++) {
+                if (bucketSizes[bucketOrder[j]] > bucketSizes[bucketOrder[i]]) {
+                    size_t temp = bucketOrder[i];
+                    bucketOrder[i] = bucketOrder[j];
+                    bucketOrder[j] = temp;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < BUCKET_COUNT && this->perfect; i++) {
+            size_t bucket = bucketOrder[i];
+            if (0 == bucketSizes[bucket]) break;
+
+            bool isPlaced = false;
+            for (uint32_t seed = 1; seed <= MAX_DISPLACEMENT && !isPlaced; seed++) {
+                isPlaced = true;
+                for (size_t j = 0; j < N && isPlaced; j++) {
+                    if (SmartOptionsHashMix(hashes[j], 0) % BUCKET_COUNT != bucket) continue;
+                    size_t slot = SmartOptionsHashMix(hashes[j], seed) & (SLOT_COUNT - 1);
+                    if (EMPTY_SLOT != this->slots[slot]) {
+                        isPlaced = false;
+                    } else {
+                        this->slots[slot] = (uint16_t)j;
+                    }
+                }
+                if (isPlaced) {
+                    this->displacements[bucket] = seed;
+                } else {
+                    // Undo the partial placement of this bucket...
+                    for (size_t slot = 0; slot < SLOT_COUNT; slot++) {
+                        if (EMPTY_SLOT != this->slots[slot] &&
+                            SmartOptionsHashMix(hashes[this->slots[slot]], 0) % BUCKET_COUNT == bucket) {
+                            this->slots[slot] = EMPTY_SLOT;
+                        }
+                    }
+                }
+            }
+            // Duplicate words can never be separated, fall back to a linear search...
+            this->perfect = isPlaced;
+        }
     }
 
     /**
-     * @brief Adds a command line options to the processing engine.
+     * @brief Looks up a word in the choice list.
      *
-     * @param prefixShort A single character used to specify the option in POSIX style
-     * @param prefixLong A string used to specify the option in GNU style.
-     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
-     * @param helpString A string which explains the option in context.
-     * @param destVariable A pointer, where the retrieved value is stored into.
+     * @param name The word to be looked up.
+     * @param value Receives the value of the word, if found.
+     *
+     * @returns true if the word is one of the choices, false otherwise.
      */
-    void AddOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString, const char **destVariable) {
-        SmartOptionsOptionArg option(prefixShort, prefixLong, metaVariable, helpString, destVariable);
-        this->options.push_back(option);
+    constexpr bool Lookup(const char *name, E &value) const {
+        return this->Lookup(name, SmartOptionsStringLength(name), value);
     }
 
     /**
-     * @brief Adds a command line flag to the processing engine.
+     * @brief Looks up a word, which need not be NUL terminated, in the choice list.
      *
-     * @param prefixShort A single character used to specify the option in POSIX style
-     * @param prefixLong A string used to specify the option in GNU style.
-     * @param helpString A string which explains the option in context.
-     * @param destVariable A pointer, where the value is retrieved and stored into.
+     * @param name The word to be looked up.
+     * @param length The number of characters in the word.
+     * @param value Receives the value of the word, if found.
+     *
+     * @returns true if the word is one of the choices, false otherwise.
      */
-    void AddFlag(char prefixShort, const char *prefixLong, const char *helpString, bool *destVariable) {
-        SmartOptionsFlagArg flag(prefixShort, prefixLong, helpString, destVariable);
-        this->flags.push_back(flag);
+    constexpr bool Lookup(const char *name, size_t length, E &value) const {
+        if (false == this->perfect) {
+            for (size_t i = 0; i < N; i++) {
+                if (SmartOptionsStringEquals(this->choices[i].name, name, length)) {
+                    value = this->choices[i].value;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        uint64_t hash = SmartOptionsHashString(name, length);
+        uint32_t seed = this->displacements[SmartOptionsHashMix(hash, 0) % BUCKET_COUNT];
+        uint16_t index = this->slots[SmartOptionsHashMix(hash, seed) & (SLOT_COUNT - 1)];
+        if (EMPTY_SLOT == index || !SmartOptionsStringEquals(this->choices[index].name, name, length)) {
+            return false;
+        }
+        value = this->choices[index].value;
+        return true;
     }
 
     /**
-     * @brief Add a positional parameter to the processing engine.
+     * @brief Appends the list of valid words to a string, in the form 'a', 'b' & 'c'.
      *
-     * @param metaVariable A string which specifies the meta variable which indicates may indicate the acceptable values.
-     * @param helpString A string which explains the option in context.
-     * @param destVariable A pointer, where the value is retrieved and stored into.
+     * @param str The string to which the list is appended.
      */
-    void AddPositionalArgument(const char *metaVariable, const char *helpString, const char **destVariable) {
-        SmartOptionsPositionalArg pos(metaVariable, helpString, destVariable);
-        this->posArgs.push_back(pos);
+    void Describe(std::string &str) const {
+        for (size_t i = 0; i < N; i++) {
+            if (i > 0) {
+                str += (i == N - 1) ? " & " : ", ";
+            }
+            str += std::string("'") + this->choices[i].name + "'";
+        }
     }
 
+private:
+    static constexpr size_t SLOT_COUNT = SmartOptionsNextPow2(2 * N);  //!< @brief Number of slots, load factor of at most 0.5.
+    static constexpr size_t BUCKET_COUNT = N / 2 + 1;                  //!< @brief Number of displacement buckets.
+    static constexpr uint32_t MAX_DISPLACEMENT = 4096;                 //!< @brief Displacements tried per bucket.
+    static constexpr uint16_t EMPTY_SLOT = 0xFFFF;                     //!< @brief Marks an unused slot.
+
+    SmartOptionsChoice<E>   choices[N];                  //!< @brief The words accepted and their values.
+    uint16_t                slots[SLOT_COUNT];           //!< @brief Slot to choice index table.
+    uint32_t                displacements[BUCKET_COUNT]; //!< @brief Seed used for the keys of each bucket.
+    bool                    perfect;                     //!< @brief false if no perfect hash could be found.
+};
+
+/**
+ * @brief Creates a choice table, deducing the number of choices from the array.
+ *
+ * @param choices The words accepted and their values.
+ *
+ * @returns The choice table.
+ */
+template <typename E, size_t N>
+constexpr SmartOptionsChoices<E, N> SmartOptionsMakeChoices(const SmartOptionsChoice<E> (&choices)[N]) {
+    return SmartOptionsChoices<E, N>(choices);
+}
+
+/**
+ * @brief An IPv4 or IPv6 address, in network byte order.
+ *
+ * @details IPv4 addresses are stored IPv4-mapped (::ffff:a.b.c.d), so both families share one layout and
+ * can be compared and sorted together.
+ */
+struct SmartOptionsIPAddress {
+    uint8_t family;     //!< @brief 4 for IPv4, 6 for IPv6, 0 if no address has been parsed.
+    uint8_t bytes[16];  //!< @brief The address in network byte order, IPv4-mapped for IPv4.
+
     /**
-     * @brief Process the command line parameters and populate the appropriate variables with the
-     * results of the processing automatically.
+     * @brief Parses a dotted quad IPv4 address (192.168.0.1) or an IPv6 address in RFC 4291 text form.
      *
-     * @param argc The number of command line parameters that are there in the argv array.
-     * @param argv The string array which contains all the command line parameters passed.
-     *
-     * @returns Based on the processing of the command line parameters, the functions returns the
-     * following codes.
+     * @param str The address string, need not be NUL terminated.
+     * @param length The number of characters in the address string.
+     * @param address Receives the address, if the string is valid.
      *
-     * @retval SMARTOPTIONS_SUCCESS if successful.
-     * @retval SMARTOPTIONS_INVALID_ARGUMENT if the processing engine encounters an invalid argument.
-     * @retval SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS if the processing engine encounters less or
-     * more number of arguments that the normal.
+     * @returns true if the string is a valid address, false otherwise.
      */
-    SMARTOPTIONS_STATUS ProcessCommandArgs(int argc, const char **argv) {
-
-        this->useCommandArgs(argc, argv);
-
-        size_t posArgsCount = 0;
-        SmartOptionsPositionalArgList::iterator posArgsIt = this->posArgs.begin();
+    static bool Parse(const char *str, size_t length, SmartOptionsIPAddress &address) {
+        SmartOptionsIPAddress result = SmartOptionsIPAddress();
+        if (memchr(str, ':', length)) {
+            result.family = 6;
+            if (!parseIPv6(str, length, result.bytes)) return false;
+        } else {
+            result.family = 4;
+            result.bytes[10] = 0xFF;
+            result.bytes[11] = 0xFF;
+            if (!parseIPv4(str, length, result.bytes + 12)) return false;
+        }
+        address = result;
+        return true;
+    }
 
-        std::string strPosArgErrMsg;
-        std::string strOptArgErrMsg;
+    /** @cond INTERNAL */
+    static bool parseIPv4(const char *str, size_t length, uint8_t *bytes) {
+        size_t index = 0;
+        for (int part = 0; part < 4; part++) {
+            if (part > 0) {
+                if (index >= length || '.' != str[index]) return false;
+                index++;
+            }
+            size_t start = index;
+            unsigned value = 0;
+            while (index < length && index - start < 3 && str[index] >= '0' && str[index] <= '9') {
+                value = value * 10 + (unsigned)(str[index++] - '0');
+            }
+            // Reject empty parts, values above 255 and leading zeros (which inet_aton() treats as octal)...
+            if (index == start || value > 255 || ('0' == str[start] && index - start > 1)) return false;
+            bytes[part] = (uint8_t)value;
+        }
+        return index == length;
+    }
 
-        std::string strErrMessage;
+    static bool parseIPv6(const char *str, size_t length, uint8_t *bytes) {
+        uint16_t groups[8] = {0};
+        int count = 0;
+        int gap = -1;   // Index of the group where "::" appears...
+        size_t index = 0;
 
-        for (int index = 1; index < argc; index++) {/* ignore first argv */
-            const char *token = this->argV[index];
-            bool isTokenProcessed = false;
-            if ('-' == token[0])
-            {
-                token++; // increment the token pointer
-                isTokenProcessed = false; // reset...
-
-                // First Process Flags...
-                if (false == isTokenProcessed) {
-                    for (SmartOptionsFlagArgList::iterator flagsIt =  this->flags.begin();
-                            flagsIt != this->flags.end();
-                            flagsIt++)
-                    {
-                        if ( (*flagsIt).prefixShort == (*(char*)token) ) {
-                            // Update the variable that has been passed while configuring...
-                            (*flagsIt->destVariable) = true;
-     
-                            isTokenProcessed = true;
-                            break;
-                        }
-                    }
-                }
+        if (length >= 2 && ':' == str[0] && ':' == str[1]) {
+            gap = 0;
+            index = 2;
+        }
+        while (index < length) {
+            const char *colon = (const char *)memchr(str + index, ':', length - index);
+            size_t end = colon ? (size_t)(colon - str) : length;
 
-                // Second Process Options...
-                if (false == isTokenProcessed) {
-                    for (SmartOptionsOptionArgList::iterator optionsIt =  this->options.begin();
-                            optionsIt != this->options.end();
-                            optionsIt++)
-                    {
-                        if ( (*optionsIt).prefixShort == (*(char*)token) ) {
-                            SmartOptionsOptionArg optionArg = (SmartOptionsOptionArg)(*optionsIt);
-                            
-                            // Update the variable that has been passed while configuring...
-                            if (SmartOptions::NULL_TERMINATE != token[1]) {
-                                // If the argument provided is not separated by space...
-                                *(optionArg.destVariable) = ++token;
-                                isTokenProcessed = true;
-                            }
-                            else if (index >= (argc-1)) {
-                                strErrMessage = std::string(": Error, missing value for '-") + (*optionsIt).prefixShort + "' option.";
-                            } else {
-                                // If the argument provided is separated by space...
-                                const char *optionStr = this->argV[++index];
-                                *(optionArg.destVariable) = optionStr;
-                                isTokenProcessed = true;
-                            }
-                        }
+            if (memchr(str + index, '.', end - index)) {
+                // Embedded IPv4 address, must be the last 32 bits...
+                uint8_t ipv4[4];
+                if (end != length || count > 6 || !parseIPv4(str + index, end - index, ipv4)) return false;
+                groups[count++] = (uint16_t)((ipv4[0] << 8) | ipv4[1]);
+                groups[count++] = (uint16_t)((ipv4[2] << 8) | ipv4[3]);
+                index = end;
+                break;
+            }
 
-                        if (isTokenProcessed) break;
-                    }
-                }
+            if (end == index || end - index > 4 || count >= 8) return false;
+            unsigned value = 0;
+            for (; index < end; index++) {
+                char c = str[index];
+                unsigned digit = (c >= '0' && c <= '9') ? (unsigned)(c - '0')
+                               : (c >= 'a' && c <= 'f') ? (unsigned)(c - 'a' + 10)
+                               : (c >= 'A' && c <= 'F') ? (unsigned)(c - 'A' + 10) : 16;
+                if (digit > 15) return false;
+                value = (value << 4) | digit;
+            }
+            groups[count++] = (uint16_t)value;
 
-                // Flag error, if the token is not processed...
-                if (false == isTokenProcessed) {
-                    if (this->autoPrintHelp) {
-                        if (strErrMessage.empty() == false)
-                            std::cout << std::string(this->appName) << strErrMessage << std::endl;
-                        else
-                            std::cout << std::string(this->appName) << ": Error, invalid argument '-" << token[0] << "'." << std::endl;
-                    }
-                    AutoPrintHelp();
-                    return SMARTOPTIONS_INVALID_ARGUMENT;
-                }
-            } else {
-                // lastly process the Positional arguments...
-                if (posArgsIt < this->posArgs.end()) {
-                    SmartOptionsPositionalArg posArg = (SmartOptionsPositionalArg)(*posArgsIt);
-
-                    // Update the variable that has been passed while configuring...
-                    *(posArg.destVariable) = token;
-                    
-                    posArgsIt++;
-                }
-                else {
-                    if (strPosArgErrMsg.empty() == true) {
-                        strPosArgErrMsg = std::string(this->appName) + ": Error, invalid number of mandatory arguments (" + token;
-                    }
-                    else {
-                        strPosArgErrMsg += std::string(", ") + token;
-                    }
-                }
-                posArgsCount++;
+            if (index == length) break;
+            index++;    // Skip ':'...
+            if (index < length && ':' == str[index]) {
+                if (gap >= 0) return false;
+                gap = count;
+                index++;
+            } else if (index == length) {
+                return false;   // Trailing single ':'...
             }
         }
 
-        // This means that we have extra positional arguments, hence fix the error message.
-        if (strPosArgErrMsg.empty() == false) {
-            strPosArgErrMsg += ")";
-            size_t loc = strPosArgErrMsg.rfind(",");
-            strPosArgErrMsg.replace(loc, 1, " &"); // Replace a single comma with space and ampersand.
+        if ((gap < 0 && count != 8) || (gap >= 0 && count > 7)) return false;
+
+        // Expand "::" by moving the groups after it to the end...
+        int zeros = 8 - count;
+        for (int i = 7; gap >= 0 && i >= gap + zeros; i--) {
+            groups[i] = groups[i - zeros];
+        }
+        for (int i = gap; gap >= 0 && i < gap + zeros; i++) {
+            groups[i] = 0;
         }
+        for (int i = 0; i < 8; i++) {
+            bytes[2 * i] = (uint8_t)(groups[i] >> 8);
+            bytes[2 * i + 1] = (uint8_t)groups[i];
+        }
+        return true;
+    }
+    /** @endcond */
+};
 
-        // Post processing validations...
-        if ( posArgsCount != this->posArgs.size() ) {
+/**
+ * @brief A network endpoint, host:port. The host is an IPv4 address, an IPv6 address in brackets
+ * ([::1]:443) or a host name.
+ */
+struct SmartOptionsEndpoint {
+    SmartOptionsIPAddress address;  //!< @brief The address of the host, family is 0 if the host is a name.
+    const char *host;               //!< @brief The host part, not NUL terminated. Points into the command line.
+    uint16_t hostLength;            //!< @brief The number of characters in the host part.
+    uint16_t port;                  //!< @brief The port number.
 
-            // In case where in we don't have sufficient mandatory parameters...
-            if (strPosArgErrMsg.empty() == true) {
-                strPosArgErrMsg = std::string(this->appName) + ": Error, invalid number of mandatory arguments";
-            }
+    /**
+     * @brief Parses a host:port endpoint.
+     *
+     * @param str The endpoint string, need not be NUL terminated.
+     * @param length The number of characters in the endpoint string.
+     * @param endpoint Receives the endpoint, if the string is valid.
+     *
+     * @returns true if the string is a valid endpoint, false otherwise.
+     */
+    static bool Parse(const char *str, size_t length, SmartOptionsEndpoint &endpoint) {
+        SmartOptionsEndpoint result = SmartOptionsEndpoint();
+        size_t portStart = 0;
 
-            if (this->autoPrintHelp) {
-                if (this->posArgs.size() == 1) {
-                    strPosArgErrMsg += ". The only mandatory parameter is '" + std::string(this->posArgs.begin()->metaVariable) + "'";
-                }
-                else {
-                    strPosArgErrMsg += ". The mandatory parameters are ";   
-                    for (posArgsIt =  this->posArgs.begin(); posArgsIt != this->posArgs.end(); posArgsIt++) {
-                        SmartOptionsPositionalArg posArg = (SmartOptionsPositionalArg)(*posArgsIt);
-                        strPosArgErrMsg += std::string("'") + posArg.metaVariable + "', ";
-                    }
-                    strPosArgErrMsg.erase(strPosArgErrMsg.size() -2); // Remove last 2 characters ", ".
-                    size_t loc = strPosArgErrMsg.rfind(",");
-                    strPosArgErrMsg.replace(loc, 1, " &"); // Replace a single comma with space and ampersand.
-                    strPosArgErrMsg += ".";
-                }
-                std::cout << strPosArgErrMsg << std::endl;
+        if (length > 0 && '[' == str[0]) {
+            const char *bracket = (const char *)memchr(str, ']', length);
+            if (NULL == bracket) return false;
+            result.host = str + 1;
+            if ((size_t)(bracket - result.host) > UINT16_MAX) return false;
+            result.hostLength = (uint16_t)(bracket - result.host);
+            portStart = (size_t)(bracket - str) + 1;
+            if (portStart >= length || ':' != str[portStart]) return false;
+            if (!SmartOptionsIPAddress::Parse(result.host, result.hostLength, result.address) || 6 != result.address.family) return false;
+        } else {
+            const char *colon = (const char *)memchr(str, ':', length);
+            // More than one ':' is an IPv6 address without brackets, which is ambiguous...
+            if (NULL == colon || memchr(colon + 1, ':', length - (size_t)(colon - str) - 1)) return false;
+            portStart = (size_t)(colon - str);
+            if (0 == portStart || portStart > 253) return false;
+            result.host = str;
+            result.hostLength = (uint16_t)portStart;
+            if (!SmartOptionsIPAddress::Parse(result.host, result.hostLength, result.address)) {
+                result.address = SmartOptionsIPAddress();
+                if (!isHostName(result.host, result.hostLength)) return false;
             }
+        }
 
-            this->AutoPrintHelp();
-            return SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS;
+        size_t index = portStart + 1;
+        unsigned port = 0;
+        if (index == length || length - index > 5) return false;
+        for (; index < length; index++) {
+            if (str[index] < '0' || str[index] > '9') return false;
+            port = port * 10 + (unsigned)(str[index] - '0');
         }
+        if (port > 65535) return false;
+        result.port = (uint16_t)port;
 
-        return SMARTOPTIONS_SUCCESS;
+        endpoint = result;
+        return true;
+    }
+
+    /** @cond INTERNAL */
+    static bool isHostName(const char *str, size_t length) {
+        bool isLastLabelNumeric = true;
+        for (size_t i = 0; i < length; i++) {
+            char c = str[i];
+            bool isLabelChar = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || '-' == c;
+            if (!isLabelChar && '.' != c) return false;
+            if ('.' == c && (0 == i || '.' == str[i - 1])) return false;
+            if ('.' == c && i + 1 < length) {
+                isLastLabelNumeric = true;
+            } else if (isLabelChar && (c < '0' || c > '9')) {
+                isLastLabelNumeric = false;
+            }
+        }
+        // A name ending in a numeric label (999.1.1.1, 1.2.3) is a malformed IPv4 address, resolvers would take
+        // it for a number rather than look it up...
+        return !isLastLabelNumeric;
     }
+    /** @endcond */
+};
+
+/**
+ * @brief A network prefix in CIDR notation (10.0.0.0/8, fe80::/10).
+ */
+struct SmartOptionsIPPrefix {
+    SmartOptionsIPAddress address;  //!< @brief The network address, all host bits are zero.
+    uint8_t prefixLength;           //!< @brief The prefix length, in bits of the address family (0-32 or 0-128).
 
     /**
-     * @brief Prints the description and help message based on the various flags, options, and positional arguments
-     * that have been added/configured.
+     * @brief Parses a prefix in CIDR notation. Prefixes with host bits set (10.0.0.1/8) are rejected.
+     *
+     * @param str The prefix string, need not be NUL terminated.
+     * @param length The number of characters in the prefix string.
+     * @param prefix Receives the prefix, if the string is valid.
+     *
+     * @returns true if the string is a valid prefix, false otherwise.
      */
-    void PrintHelp() {
-        printf("%s %s \n", this->appName, this->usage);
-        //printf("%s \n", this->description);
+    static bool Parse(const char *str, size_t length, SmartOptionsIPPrefix &prefix) {
+        SmartOptionsIPPrefix result = SmartOptionsIPPrefix();
+        const char *slash = (const char *)memchr(str, '/', length);
+        if (NULL == slash) return false;
 
-        char leftContent[64] = {0};
-
-        for (SmartOptionsOptionArgList::iterator optionsIt =  this->options.begin();
-                optionsIt != this->options.end();
-                optionsIt++)
-        {
-            SmartOptionsOptionArg option = (SmartOptionsOptionArg)(*optionsIt);
+        size_t addressLength = (size_t)(slash - str);
+        if (!SmartOptionsIPAddress::Parse(str, addressLength, result.address)) return false;
 
-            sprintf(leftContent, "  -%c <%s> ", option.prefixShort, option.metaVariable);
-            printf("%-32s %s \n", leftContent, option.helpString);
+        size_t index = addressLength + 1;
+        unsigned bits = 0;
+        // Reject an empty length, and leading zeros (/032)...
+        if (index == length || length - index > 3 || ('0' == str[index] && length - index > 1)) return false;
+        for (; index < length; index++) {
+            if (str[index] < '0' || str[index] > '9') return false;
+            bits = bits * 10 + (unsigned)(str[index] - '0');
         }
+        if (bits > (4 == result.address.family ? 32u : 128u)) return false;
+        result.prefixLength = (uint8_t)bits;
 
-        for (SmartOptionsFlagArgList::iterator flagsIt =  this->flags.begin();
-                                    flagsIt != this->flags.end();
-                                    flagsIt++)
-        {
-            SmartOptionsFlagArg flag = (SmartOptionsFlagArg) (*flagsIt);
-            sprintf(leftContent, "  -%c", flag.prefixShort);
-            printf("%-32s %s \n", leftContent, flag.helpString);
+        // The host bits must be zero...
+        unsigned mappedBits = result.MappedLength();
+        for (unsigned bit = mappedBits; bit < 128; bit++) {
+            if (result.address.bytes[bit / 8] & (0x80 >> (bit % 8))) return false;
         }
+
+        prefix = result;
+        return true;
     }
 
-private: // Private Member functions...
     /**
-     * @brief Sets the internal member variables to use the passed variables, and also extracts and sets the program name...
-     *
-     * @param argC An integer value specifying the number of entries in the argV array.
-     * @param argV A string array containing the list of command line parameters to be processed.
+     * @brief Returns the prefix length within the 128 bit (IPv4-mapped) address.
      */
-    void useCommandArgs(int argC, const char **argV) {
-        this->argC = argC;
-        this->argV = argV;
+    unsigned MappedLength() const {
+        return (4 == this->address.family) ? 96u + this->prefixLength : this->prefixLength;
     }
+};
 
+/**
+ * @brief A table of network prefixes, collected from repeated prefix options, kept sorted and merged
+ * into disjoint address ranges so that Contains() is a binary search.
+ */
+class SmartOptionsIPPrefixTable {
+public:
     /**
-     * @brief Print help if Auto-Help option is enabled...
+     * @brief Adds a prefix to the table.
+     *
+     * @param prefix The prefix to be added.
      */
-    void AutoPrintHelp() {
-        if (true == this->autoPrintHelp) {
-            this->PrintHelp();
+    void Insert(const SmartOptionsIPPrefix &prefix) {
+        Range range = Range::FromPrefix(prefix);
+
+        std::vector<SmartOptionsIPPrefix>::iterator prefixIt = this->prefixes.begin();
+        while (prefixIt != this->prefixes.end() && !(range.first < Range::FromPrefix(*prefixIt).first)) {
+            prefixIt++;
+        }
+        this->prefixes.insert(prefixIt, prefix);
+
+        // Merge the new range with the overlapping and adjacent ranges...
+        std::vector<Range>::iterator rangeIt = this->ranges.begin();
+        while (rangeIt != this->ranges.end() && rangeIt->last.Next() < range.first) {
+            rangeIt++;
+        }
+        while (rangeIt != this->ranges.end() && !(range.last.Next() < rangeIt->first)) {
+            if (rangeIt->first < range.first) range.first = rangeIt->first;
+            if (range.last < rangeIt->last) range.last = rangeIt->last;
+            rangeIt = this->ranges.erase(rangeIt);
+        }
+        this->ranges.insert(rangeIt, range);
+    }
+
+    /**
+     * @brief Checks whether an address is covered by any prefix of the table.
+     *
+     * @param address The address to be looked up.
+     *
+     * @returns true if the address is within one of the prefixes, false otherwise.
+     */
+    bool Contains(const SmartOptionsIPAddress &address) const {
+        Value value = Value::FromBytes(address.bytes);
+        size_t low = 0, high = this->ranges.size();
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (this->ranges[mid].last < value) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low < this->ranges.size() && !(value < this->ranges[low].first);
+    }
+
+    /**
+     * @brief Returns the prefixes of the table, sorted by network address.
+     */
+    const std::vector<SmartOptionsIPPrefix> &Prefixes() const {
+        return this->prefixes;
+    }
+
+private:
+    /** @cond INTERNAL */
+    struct Value {
+        uint64_t high;
+        uint64_t low;
+
+        static Value FromBytes(const uint8_t *bytes) {
+            Value value = { 0, 0 };
+            for (int i = 0; i < 8; i++) {
+                value.high = (value.high << 8) | bytes[i];
+                value.low = (value.low << 8) | bytes[i + 8];
+            }
+            return value;
+        }
+        Value Next() const {
+            // Saturates at the last address, so that the top range is never merged past it...
+            Value next = *this;
+            if (++next.low == 0 && ++next.high == 0) return *this;
+            return next;
+        }
+        bool operator<(const Value &other) const {
+            return this->high < other.high || (this->high == other.high && this->low < other.low);
+        }
+    };
+
+    struct Range {
+        Value first;
+        Value last;
+
+        static Range FromPrefix(const SmartOptionsIPPrefix &prefix) {
+            Range range;
+            range.first = Value::FromBytes(prefix.address.bytes);
+            range.last = range.first;
+            unsigned hostBits = 128 - prefix.MappedLength();
+            if (hostBits >= 64) {
+                range.last.low = ~(uint64_t)0;
+                range.last.high |= (hostBits == 128) ? ~(uint64_t)0 : (((uint64_t)1 << (hostBits - 64)) - 1);
+            } else if (hostBits > 0) {
+                range.last.low |= ((uint64_t)1 << hostBits) - 1;
+            }
+            return range;
+        }
+    };
+    /** @endcond */
+
+    std::vector<SmartOptionsIPPrefix> prefixes;   //!< @brief The prefixes, sorted by network address.
+    std::vector<Range> ranges;                    //!< @brief The disjoint address ranges covered by the prefixes, sorted.
+};
+
+/**
+ * @brief A point in time (UTC) with nanosecond resolution, the same type as
+ * std::chrono::sys_time<std::chrono::nanoseconds>. Covers the years 1678 to 2261.
+ */
+typedef std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> SmartOptionsTimestamp;
+
+/** @cond INTERNAL */
+
+/**
+ * @brief Converts a fixed number of decimal digits, without branching on each digit.
+ *
+ * @returns false if any of the characters is not a digit.
+ */
+inline bool SmartOptionsParseDigits(const char *str, size_t count, int &value) {
+    unsigned isValid = 1;
+    int result = 0;
+    for (size_t i = 0; i < count; i++) {
+        unsigned digit = (unsigned)(str[i] - '0');
+        isValid &= (digit <= 9);
+        result = result * 10 + (int)digit;
+    }
+    value = result;
+    return isValid != 0;
+}
+
+/**
+ * @brief Returns the number of days since 1970-01-01 for a date of the proleptic Gregorian calendar.
+ */
+inline constexpr int64_t SmartOptionsDaysFromCivil(int64_t year, unsigned month, unsigned day) {
+    year -= (month <= 2);
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yearOfEra = (unsigned)(year - era * 400);
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int64_t)dayOfEra - 719468;
+}
+
+/** @endcond */
+
+/**
+ * @brief Parses an ISO-8601 / RFC 3339 timestamp, without using the locale or the time zone database.
+ *
+ * @details Accepted forms are YYYY-MM-DD (midnight UTC) and YYYY-MM-DDTHH:MM:SS[.fraction]<offset>, where 'T' may
+ * also be 't' or a space, the fraction has up to 9 significant digits and the offset is Z, +HH:MM, +HHMM or +HH
+ * (or '-'). A time without an offset is rejected, as it would need the local time zone.
+ *
+ * @param str The timestamp string, need not be NUL terminated.
+ * @param length The number of characters in the timestamp string.
+ * @param timestamp Receives the timestamp, if the string is valid.
+ *
+ * @retval SMARTOPTIONS_SUCCESS if the timestamp is valid.
+ * @retval SMARTOPTIONS_INVALID_FORMAT if the string is not in one of the accepted forms.
+ * @retval SMARTOPTIONS_OUT_OF_RANGE if a field is out of range (2023-02-30), or the time can not be represented.
+ */
+inline SMARTOPTIONS_STATUS SmartOptionsParseTimestamp(const char *str, size_t length, SmartOptionsTimestamp &timestamp) {
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    int64_t nanoseconds = 0;
+    int offsetSeconds = 0;
+
+    if (length < 10 || '-' != str[4] || '-' != str[7] ||
+        !SmartOptionsParseDigits(str, 4, year) || !SmartOptionsParseDigits(str + 5, 2, month) || !SmartOptionsParseDigits(str + 8, 2, day)) {
+        return SMARTOPTIONS_INVALID_FORMAT;
+    }
+
+    if (length > 10) {
+        char separator = str[10];
+        if (length < 20 || ('T' != separator && 't' != separator && ' ' != separator) || ':' != str[13] || ':' != str[16] ||
+            !SmartOptionsParseDigits(str + 11, 2, hour) || !SmartOptionsParseDigits(str + 14, 2, minute) || !SmartOptionsParseDigits(str + 17, 2, second)) {
+            return SMARTOPTIONS_INVALID_FORMAT;
+        }
+
+        size_t index = 19;
+        if ('.' == str[index]) {
+            size_t start = ++index;
+            int64_t scale = 100000000;
+            for (; index < length && (unsigned)(str[index] - '0') <= 9; index++) {
+                nanoseconds += (str[index] - '0') * scale;   // Digits beyond nanoseconds are truncated...
+                scale /= 10;
+            }
+            if (index == start) return SMARTOPTIONS_INVALID_FORMAT;
+        }
+
+        if (index == length) return SMARTOPTIONS_INVALID_FORMAT;   // No offset...
+        char sign = str[index++];
+        if ('Z' == sign || 'z' == sign) {
+            if (index != length) return SMARTOPTIONS_INVALID_FORMAT;
+        } else if ('+' == sign || '-' == sign) {
+            int offsetHours = 0, offsetMinutes = 0;
+            size_t remaining = length - index;
+            bool isValid = (2 == remaining || 4 == remaining || (5 == remaining && ':' == str[index + 2]));
+            if (!isValid || !SmartOptionsParseDigits(str + index, 2, offsetHours) ||
+                (remaining > 2 && !SmartOptionsParseDigits(str + length - 2, 2, offsetMinutes))) {
+                return SMARTOPTIONS_INVALID_FORMAT;
+            }
+            if (offsetHours > 23 || offsetMinutes > 59) return SMARTOPTIONS_OUT_OF_RANGE;
+            offsetSeconds = (offsetHours * 3600 + offsetMinutes * 60) * ('-' == sign ? -1 : 1);
+        } else {
+            return SMARTOPTIONS_INVALID_FORMAT;
+        }
+    }
+
+    static const int DAYS_IN_MONTH[] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool isLeapYear = (0 == year % 4) && (0 != year % 100 || 0 == year % 400);
+    if (month < 1 || month > 12 || day < 1 || day > DAYS_IN_MONTH[month - 1] || (2 == month && 29 == day && !isLeapYear) ||
+        hour > 23 || minute > 59 || second > 59) {
+        return SMARTOPTIONS_OUT_OF_RANGE;
+    }
+
+    int64_t seconds = SmartOptionsDaysFromCivil(year, (unsigned)month, (unsigned)day) * 86400 + hour * 3600 + minute * 60 + second - offsetSeconds;
+    // The range of a signed 64 bit count of nanoseconds is +/- 9223372036.854775807 seconds...
+    if (seconds < -9223372035 || seconds > 9223372035) {
+        return SMARTOPTIONS_OUT_OF_RANGE;
+    }
+    timestamp = SmartOptionsTimestamp(std::chrono::nanoseconds(seconds * 1000000000 + nanoseconds));
+    return SMARTOPTIONS_SUCCESS;
+}
+
+/**
+ * @brief The value of a file backed option, whose content is read from a file only when it is first accessed.
+ *
+ * @details On POSIX systems the file is mapped read-only with mmap() on the first call to View(), so large values
+ * (queries, JSON documents, key material) never pass through argv, and a file which is never accessed is
+ * never opened. An inline value (see SmartOptions::AddFileOption()) is returned as is, without a copy.
+ * View() is not thread safe until the first call has returned.
+ */
+class SmartOptionsFileValue {
+public:
+    /**
+     * @brief The Constructor.
+     */
+    SmartOptionsFileValue()
+    : path(NULL),
+      value(NULL),
+      data(NULL),
+      size(0),
+      isMapped(false)
+    {
+    }
+
+    /**
+     * @brief The Destructor, unmaps the file.
+     */
+    ~SmartOptionsFileValue() {
+        this->release();
+    }
+
+    SmartOptionsFileValue(const SmartOptionsFileValue &) = delete;
+    SmartOptionsFileValue &operator=(const SmartOptionsFileValue &) = delete;
+
+    /**
+     * @brief Returns true if the option has been passed.
+     */
+    bool IsSet() const {
+        return NULL != this->path || NULL != this->value;
+    }
+
+    /**
+     * @brief Returns the path of the file, or NULL if the option was not passed or has an inline value.
+     */
+    const char *Path() const {
+        return this->path;
+    }
+
+    /**
+     * @brief Returns the content of the file (or the inline value), mapping the file on the first call.
+     *
+     * @param view Receives a read-only view of the content. Empty if the option was not passed.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the content is available.
+     * @retval SMARTOPTIONS_SYSTEM_ERROR if the file could not be opened or mapped, check errno.
+     */
+    SMARTOPTIONS_STATUS View(std::string_view &view) {
+        if (NULL != this->value) {
+            view = std::string_view(this->value);
+            return SMARTOPTIONS_SUCCESS;
+        }
+        if (NULL != this->path && !this->isMapped) {
+            SMARTOPTIONS_STATUS status = this->map();
+            if (SMARTOPTIONS_SUCCESS != status) return status;
+        }
+        view = std::string_view(this->data, this->size);
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /** @cond INTERNAL */
+    /**
+     * @brief Binds the value to a file path or an inline value, dropping any earlier mapping.
+     */
+    void assign(const char *path, const char *value) {
+        this->release();
+        this->path = path;
+        this->value = value;
+    }
+    /** @endcond */
+
+private:
+    /**
+     * @brief Maps (or on platforms without mmap(), reads) the file.
+     */
+    SMARTOPTIONS_STATUS map() {
+#if defined(_WIN32)
+        std::ifstream file(this->path, std::ios::in | std::ios::binary);
+        if (!file) return SMARTOPTIONS_SYSTEM_ERROR;
+        this->buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        this->data = this->buffer.data();
+        this->size = this->buffer.size();
+#else
+        int fd = open(this->path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return SMARTOPTIONS_SYSTEM_ERROR;
+
+        struct stat fileStat;
+        if (0 != fstat(fd, &fileStat)) {
+            int savedErrno = errno;
+            close(fd);
+            errno = savedErrno;
+            return SMARTOPTIONS_SYSTEM_ERROR;
+        }
+        if (fileStat.st_size > 0) {
+            void *mapping = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED == mapping) {
+                int savedErrno = errno;
+                close(fd);
+                errno = savedErrno;
+                return SMARTOPTIONS_SYSTEM_ERROR;
+            }
+            this->data = static_cast<const char *>(mapping);
+            this->size = (size_t)fileStat.st_size;
+        }
+        close(fd);  // The mapping stays valid after the descriptor is closed...
+#endif
+        this->isMapped = true;
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Unmaps the file, if it has been mapped.
+     */
+    void release() {
+#if defined(_WIN32)
+        std::vector<char>().swap(this->buffer);
+#else
+        if (this->isMapped && this->size > 0) {
+            munmap(const_cast<char *>(this->data), this->size);
+        }
+#endif
+        this->data = NULL;
+        this->size = 0;
+        this->isMapped = false;
+    }
+
+    const char *path;   //!< @brief The path of the file. Points into the command line.
+    const char *value;  //!< @brief The inline value, used instead of a file. Points into the command line.
+    const char *data;   //!< @brief The content of the file, once mapped.
+    size_t size;        //!< @brief The size of the content.
+    bool isMapped;      //!< @brief true once the file has been mapped.
+#if defined(_WIN32)
+    std::vector<char> buffer;   //!< @brief The content of the file, read into memory.
+#endif
+};
+
+/**
+ * @brief A bump allocator for strings created while (or after) processing a command line, like expanded
+ * option values. Memory is released all at once, when the next command line is processed.
+ */
+class SmartOptionsArena {
+public:
+    /**
+     * @brief The Constructor.
+     *
+     * @param resource The memory resource, the chunks are allocated from.
+     */
+    explicit SmartOptionsArena(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+    : chunks(resource),
+      used(0)
+    {
+    }
+
+    SmartOptionsArena(const SmartOptionsArena &) = delete;
+    SmartOptionsArena &operator=(const SmartOptionsArena &) = delete;
+
+    /**
+     * @brief The Destructor, releases all the chunks.
+     */
+    ~SmartOptionsArena() {
+        this->release(0);
+    }
+
+    /**
+     * @brief Allocates memory from the arena.
+     *
+     * @param size The number of bytes required.
+     *
+     * @returns The memory, valid until Reset() is called or the arena is destroyed.
+     *
+     * @throws std::bad_alloc if the memory resource is exhausted.
+     */
+    char *Allocate(size_t size) {
+        if (this->chunks.empty() || this->used + size > this->chunks.back().size) {
+            std::pmr::memory_resource *resource = this->chunks.get_allocator().resource();
+            if (this->chunks.size() == this->chunks.capacity()) this->chunks.reserve(std::max<size_t>(4, 2 * this->chunks.size()));
+            Chunk chunk;
+            chunk.size = std::max(size, CHUNK_SIZE);
+            chunk.data = (char *)resource->allocate(chunk.size, 1);
+            this->chunks.push_back(chunk);
+            this->used = 0;
+        }
+        char *memory = this->chunks.back().data + this->used;
+        this->used += size;
+        return memory;
+    }
+
+    /**
+     * @brief Releases all the memory allocated from the arena, keeping the first chunk for reuse.
+     */
+    void Reset() {
+        this->release(1);
+        this->used = 0;
+    }
+
+    /**
+     * @brief Retrieves the number of bytes held by the arena, used or not.
+     */
+    size_t MemoryFootprint() const {
+        size_t size = this->chunks.capacity() * sizeof(Chunk);
+        for (size_t index = 0; index < this->chunks.size(); index++) size += this->chunks[index].size;
+        return size;
+    }
+
+private:
+    /** @cond INTERNAL */
+    struct Chunk {
+        char *data;
+        size_t size;
+    };
+    /** @endcond */
+
+    /**
+     * @brief Returns the chunks to the memory resource, but the first ones.
+     *
+     * @param kept The number of chunks kept.
+     */
+    void release(size_t kept) {
+        std::pmr::memory_resource *resource = this->chunks.get_allocator().resource();
+        while (this->chunks.size() > kept) {
+            resource->deallocate(this->chunks.back().data, this->chunks.back().size, 1);
+            this->chunks.pop_back();
+        }
+    }
+
+    static constexpr size_t CHUNK_SIZE = 4096;   //!< @brief The size of a chunk, unless a larger block is requested.
+
+    std::pmr::vector<Chunk> chunks; //!< @brief The chunks, the last one is being allocated from.
+    size_t used;                //!< @brief The number of bytes used in the last chunk.
+};
+
+/**
+ * @brief The value of an option in which environment variables ($VAR, ${VAR}) and a leading '~' are expanded,
+ * when the value is first read.
+ *
+ * @details Expansion is not done while processing the command line. A value without '$' and without a leading
+ * '~' is returned as is, without a copy; an expanded value is kept in the arena of the SmartOptions object, and
+ * is valid until it processes the next command line. "$$" stands for '$', unset variables expand to nothing and
+ * '~user' is not expanded. Get() is not thread safe until the first call has returned.
+ */
+class SmartOptionsExpandedValue {
+public:
+    /**
+     * @brief The Constructor.
+     */
+    SmartOptionsExpandedValue()
+    : raw(NULL),
+      expanded(NULL),
+      arena(NULL)
+    {
+    }
+
+    /**
+     * @brief Returns the value as passed on the command line, or NULL if the option was not passed.
+     */
+    const char *Raw() const {
+        return this->raw;
+    }
+
+    /**
+     * @brief Returns the expanded value, or NULL if the option was not passed.
+     */
+    const char *Get() {
+        if (NULL == this->expanded && NULL != this->raw) {
+            size_t length = strlen(this->raw);
+            if ('~' != this->raw[0] && NULL == memchr(this->raw, '$', length)) {
+                this->expanded = this->raw;
+            } else {
+                std::string value;
+                expand(this->raw, value);
+                char *buffer = this->arena->Allocate(value.size() + 1);
+                memcpy(buffer, value.c_str(), value.size() + 1);
+                this->expanded = buffer;
+            }
+        }
+        return this->expanded;
+    }
+
+    /** @cond INTERNAL */
+    /**
+     * @brief Binds the value to a command line value, to be expanded into the given arena.
+     */
+    void assign(const char *raw, SmartOptionsArena *arena) {
+        this->raw = raw;
+        this->expanded = NULL;
+        this->arena = arena;
+    }
+
+    /**
+     * @brief Expands a value, in a single pass: each variable is looked up once, and its value appended as read.
+     *
+     * @param raw The value to be expanded.
+     * @param out Receives the expanded value.
+     */
+    static void expand(const char *raw, std::string &out) {
+        const char *str = raw;
+
+        out.reserve(strlen(raw));
+        if ('~' == str[0] && ('/' == str[1] || '\0' == str[1])) {
+#if defined(_WIN32)
+            append(out, getenv("USERPROFILE"));
+#else
+            append(out, getenv("HOME"));
+#endif
+            str++;
+        }
+
+        while ('\0' != *str) {
+            const char *name = NULL;
+            size_t nameLength = 0;
+            const char *next = str + 1;
+
+            if ('$' == str[0] && '{' == str[1]) {
+                const char *close = strchr(str + 2, '}');
+                if (NULL != close) {
+                    name = str + 2;
+                    nameLength = (size_t)(close - name);
+                    next = close + 1;
+                }
+            } else if ('$' == str[0] && (isalpha((unsigned char)str[1]) || '_' == str[1])) {
+                name = str + 1;
+                for (next = name; isalnum((unsigned char)*next) || '_' == *next; next++) {
+                }
+                nameLength = (size_t)(next - name);
+            } else if ('$' == str[0] && '$' == str[1]) {
+                next = str + 2;
+            }
+
+            if (NULL != name) {
+                // The name is NUL terminated at the end of the output, for getenv(), and replaced by its value...
+                size_t offset = out.size();
+                out.append(name, nameLength);
+                const char *value = getenv(out.c_str() + offset);
+                out.resize(offset);
+                append(out, value);
+            } else {
+                out.push_back(str[0]);
+            }
+            str = next;
+        }
+    }
+
+    static void append(std::string &out, const char *value) {
+        if (NULL != value) out.append(value);
+    }
+    /** @endcond */
+
+private:
+    const char *raw;            //!< @brief The value as passed. Points into the command line.
+    const char *expanded;       //!< @brief The expanded value, once read.
+    SmartOptionsArena *arena;   //!< @brief The arena, which the expanded value is allocated from.
+};
+
+/**
+ * @brief The customisation point for options bound to user defined types.
+ *
+ * @details Specialise it for a type T with a static parse() function, and options of type T can be added with
+ * SmartOptions::AddOption(). The function is called directly from the conversion of the option, without virtual
+ * dispatch or converter objects.
+ *
+ * @code
+    struct ShardKey { uint32_t shard; };
+
+    template <>
+    struct SmartOptionsConverter<ShardKey> {
+        static SMARTOPTIONS_STATUS parse(std::string_view value, ShardKey &result) {
+            if (value.substr(0, 6) != "shard-") return SMARTOPTIONS_INVALID_FORMAT;
+            return SmartOptionsConverter<uint32_t>::parse(value.substr(6), result.shard);
+        }
+    };
+
+    ShardKey shardKey;
+    smartOptions.AddOption('k', "shard", "KEY", "The shard to be processed.", &shardKey);
+   @endcode
+ *
+ * parse() returns SMARTOPTIONS_SUCCESS, or the error to be returned by SmartOptions::ProcessCommandArgs(), typically
+ * SMARTOPTIONS_INVALID_FORMAT or SMARTOPTIONS_OUT_OF_RANGE. Specialisations are provided for the integral types.
+ */
+template <typename T, typename Enable = void>
+struct SmartOptionsConverter;
+
+/**
+ * @brief Converts integral values (decimal, with an optional sign), see SmartOptionsConverter.
+ */
+template <typename T>
+struct SmartOptionsConverter<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+    /**
+     * @brief Converts a value.
+     *
+     * @param value The value string.
+     * @param result Receives the converted value.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the value is converted.
+     * @retval SMARTOPTIONS_INVALID_FORMAT if the value is not a decimal number.
+     * @retval SMARTOPTIONS_OUT_OF_RANGE if the value does not fit into T.
+     */
+    static SMARTOPTIONS_STATUS parse(std::string_view value, T &result) {
+        const char *first = value.data();
+        const char *end = value.data() + value.size();
+        if (first != end && '+' == *first && (end - first) > 1 && '-' != first[1]) first++;  // from_chars() rejects a leading '+'...
+
+        T converted = T();
+        std::from_chars_result status = std::from_chars(first, end, converted);
+        if (std::errc::result_out_of_range == status.ec) return SMARTOPTIONS_OUT_OF_RANGE;
+        if (std::errc() != status.ec || status.ptr != end) return SMARTOPTIONS_INVALID_FORMAT;
+        result = converted;
+        return SMARTOPTIONS_SUCCESS;
+    }
+};
+
+/**
+ * @brief Converts floating point values with std::from_chars(), which is locale independent, correctly rounded
+ * and does not allocate, see SmartOptionsConverter.
+ */
+template <typename T>
+struct SmartOptionsConverter<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    /**
+     * @brief Converts a value.
+     *
+     * @param value The value string.
+     * @param result Receives the converted value.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the value is converted.
+     * @retval SMARTOPTIONS_INVALID_FORMAT if the value is not a floating point number.
+     * @retval SMARTOPTIONS_OUT_OF_RANGE if the value can not be represented by T.
+     */
+    static SMARTOPTIONS_STATUS parse(std::string_view value, T &result) {
+        const char *first = value.data();
+        const char *end = value.data() + value.size();
+        if (first != end && '+' == *first && (end - first) > 1 && '-' != first[1]) first++;  // from_chars() rejects a leading '+'...
+
+        T converted = T();
+        std::from_chars_result status = std::from_chars(first, end, converted);
+        if (std::errc::result_out_of_range == status.ec) return SMARTOPTIONS_OUT_OF_RANGE;
+        if (std::errc() != status.ec || status.ptr != end) return SMARTOPTIONS_INVALID_FORMAT;
+        result = converted;
+        return SMARTOPTIONS_SUCCESS;
+    }
+};
+
+/**
+ * @brief Converts ISO-8601 timestamps with SmartOptionsParseTimestamp(), see SmartOptionsConverter.
+ */
+template <>
+struct SmartOptionsConverter<SmartOptionsTimestamp> {
+    /**
+     * @brief Converts a value, see SmartOptionsParseTimestamp().
+     */
+    static SMARTOPTIONS_STATUS parse(std::string_view value, SmartOptionsTimestamp &result) {
+        return SmartOptionsParseTimestamp(value.data(), value.size(), result);
+    }
+};
+
+/**
+ * @brief Hashes the canonical form of a converted value, so that the spellings of the same value (1.0 and 1.00,
+ * ::1 and 0:0:0:0:0:0:0:1) get the same fingerprint, see SmartOptionsResult::Fingerprint().
+ *
+ * @details Integers, enums, floating point numbers, timestamps, addresses, prefixes and feature masks are hashed
+ * by their value. Specialize the template, with IS_CANONICAL set to true, for the types of SmartOptionsConverter;
+ * the values of the types without a canonical form are hashed as they are spelled.
+ */
+template <typename T>
+struct SmartOptionsCanonical {
+    static constexpr bool IS_CANONICAL = std::is_integral<T>::value || std::is_enum<T>::value
+                                         || std::is_same<T, float>::value || std::is_same<T, double>::value;  //!< @brief true if T is hashed by its value.
+
+    /**
+     * @brief Hashes a value.
+     */
+    static uint64_t Hash(const T &value) {
+        T normalized = value;
+        if constexpr (std::is_floating_point<T>::value) {
+            if (0 == normalized) normalized = T();     // -0.0 is 0.0...
+        }
+        char bytes[sizeof(T)];
+        memcpy(bytes, &normalized, sizeof(T));
+        return SmartOptionsHashString(bytes, sizeof(T));
+    }
+};
+
+/**
+ * @brief Hashes timestamps by their number of nanoseconds.
+ */
+template <>
+struct SmartOptionsCanonical<SmartOptionsTimestamp> {
+    static constexpr bool IS_CANONICAL = true;
+
+    static uint64_t Hash(const SmartOptionsTimestamp &value) {
+        return SmartOptionsCanonical<int64_t>::Hash((int64_t)value.time_since_epoch().count());
+    }
+};
+
+/**
+ * @brief Hashes addresses by their family and bytes, IPv4 addresses are stored IPv4-mapped.
+ */
+template <>
+struct SmartOptionsCanonical<SmartOptionsIPAddress> {
+    static constexpr bool IS_CANONICAL = true;
+
+    static uint64_t Hash(const SmartOptionsIPAddress &value) {
+        char bytes[1 + sizeof(value.bytes)];
+        bytes[0] = (char)value.family;
+        memcpy(bytes + 1, value.bytes, sizeof(value.bytes));
+        return SmartOptionsHashString(bytes, sizeof(bytes));
+    }
+};
+
+/**
+ * @brief Hashes endpoints by their address, or their lower case host name, and their port.
+ */
+template <>
+struct SmartOptionsCanonical<SmartOptionsEndpoint> {
+    static constexpr bool IS_CANONICAL = true;
+
+    static uint64_t Hash(const SmartOptionsEndpoint &value) {
+        std::string host;
+        if (0 == value.address.family) {
+            for (uint16_t index = 0; index < value.hostLength; index++) host += (char)tolower((unsigned char)value.host[index]);
+        }
+        uint64_t hash = (0 != value.address.family) ? SmartOptionsCanonical<SmartOptionsIPAddress>::Hash(value.address)
+                                                    : SmartOptionsHashString(host.data(), host.size());
+        return SmartOptionsHashFinalize(hash ^ value.port);
+    }
+};
+
+/**
+ * @brief Hashes prefixes by their network address and length.
+ */
+template <>
+struct SmartOptionsCanonical<SmartOptionsIPPrefix> {
+    static constexpr bool IS_CANONICAL = true;
+
+    static uint64_t Hash(const SmartOptionsIPPrefix &value) {
+        return SmartOptionsHashFinalize(SmartOptionsCanonical<SmartOptionsIPAddress>::Hash(value.address) ^ value.prefixLength);
+    }
+};
+
+/**
+ * @brief Hashes prefix tables by their prefixes, which are kept sorted.
+ */
+template <>
+struct SmartOptionsCanonical<SmartOptionsIPPrefixTable> {
+    static constexpr bool IS_CANONICAL = true;
+
+    static uint64_t Hash(const SmartOptionsIPPrefixTable &value) {
+        uint64_t hash = 0;
+        for (size_t index = 0; index < value.Prefixes().size(); index++) {
+            hash = SmartOptionsHashFinalize(hash ^ SmartOptionsCanonical<SmartOptionsIPPrefix>::Hash(value.Prefixes()[index]));
+        }
+        return hash;
+    }
+};
+
+/**
+ * @brief Hashes feature masks of more than 64 features by their bits.
+ */
+template <size_t N>
+struct SmartOptionsCanonical<std::bitset<N>> {
+    static constexpr bool IS_CANONICAL = true;
+
+    static uint64_t Hash(const std::bitset<N> &value) {
+        std::string bits = value.to_string();
+        return SmartOptionsHashString(bits.data(), bits.size());
+    }
+};
+
+/** @cond INTERNAL */
+
+/**
+ * @brief The value of a variable before the first command line was processed, restored when the option of the
+ * variable is no longer passed, see SmartOptions::ProcessCommandArgsEdit().
+ *
+ * @details The value is copied once, with the type selected when the option is added. Variables which can not be
+ * copied start out empty, and are emptied again instead (a SmartOptionsFileValue is unbound).
+ */
+class SmartOptionsDefault {
+public:
+    SmartOptionsDefault() : isSaved(false), save(NULL), restore(NULL) {}
+
+    /**
+     * @brief Creates an empty default, for a variable of type T.
+     */
+    template <typename T>
+    static SmartOptionsDefault For() {
+        SmartOptionsDefault initial;
+        initial.save = &SmartOptionsDefault::saveValue<T>;
+        initial.restore = &SmartOptionsDefault::restoreValue<T>;
+        return initial;
+    }
+
+    /**
+     * @brief Copies the value of the variable, unless it has been copied before.
+     *
+     * @param variable The variable.
+     * @param resource The memory resource the copy is allocated from.
+     */
+    void Save(const void *variable, std::pmr::memory_resource *resource) {
+        if (this->isSaved || NULL == this->save) return;
+        this->value = this->save(variable, resource);
+        this->isSaved = true;
+    }
+
+    /**
+     * @brief Restores the copied value into the variable, if it has been saved.
+     */
+    void Restore(void *variable) const {
+        if (this->isSaved) this->restore(this->value.get(), variable);
+    }
+
+    /**
+     * @brief Copies the saved value, or the variable if nothing has been saved yet, with the default memory resource.
+     *
+     * @param variable The variable.
+     *
+     * @returns The copy, empty if T can not be copied.
+     */
+    std::shared_ptr<void> Copy(const void *variable) const {
+        if (NULL == this->save) return std::shared_ptr<void>();
+        return this->save(this->isSaved ? this->value.get() : variable, std::pmr::get_default_resource());
+    }
+
+private:
+    template <typename T>
+    static constexpr bool isCopyable() {
+        return std::is_copy_constructible<T>::value && std::is_copy_assignable<T>::value;
+    }
+
+    template <typename T>
+    static std::shared_ptr<void> saveValue(const void *variable, std::pmr::memory_resource *resource) {
+        if constexpr (isCopyable<T>()) {
+            return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource), *static_cast<const T *>(variable));
+        } else {
+            return std::shared_ptr<void>();
+        }
+    }
+
+    template <typename T>
+    static void restoreValue(const void *value, void *variable) {
+        if constexpr (isCopyable<T>()) *static_cast<T *>(variable) = *static_cast<const T *>(value);
+        else SmartOptionsDefault::clear(static_cast<T *>(variable));
+    }
+
+    /**
+     * @brief Empties a variable, which can not be copied.
+     */
+    static void clear(SmartOptionsFileValue *variable) {
+        variable->assign(NULL, NULL);
+    }
+
+    template <typename T>
+    static void clear(T *variable) {
+        if constexpr (std::is_default_constructible<T>::value && std::is_move_assignable<T>::value) *variable = T();
+    }
+
+    bool isSaved;                   //!< @brief true once the value has been copied, or found not to be copyable.
+    std::shared_ptr<void> value;    //!< @brief The copied value, shared by the copies of the options.
+    std::shared_ptr<void> (*save)(const void *variable, std::pmr::memory_resource *resource);   //!< @brief Copies a T.
+    void (*restore)(const void *value, void *variable);                                         //!< @brief Assigns a T.
+};
+
+/**
+ * @brief Describes how a member of a bound struct is converted, selected by the type of the member.
+ */
+template <typename T>
+struct SmartOptionsMemberTraits {
+    static constexpr bool IS_FLAG = false;  //!< @brief true if the member is set without a value.
+
+    /**
+     * @brief Converts a value into the member, through SmartOptionsConverter.
+     */
+    static SMARTOPTIONS_STATUS convert(const char *value, void *member) {
+        return SmartOptionsConverter<T>::parse(std::string_view(value), *static_cast<T *>(member));
+    }
+
+    /**
+     * @brief Checks a value, by converting it into a scratch T; the member is not written.
+     */
+    static SMARTOPTIONS_STATUS check(const char *value) {
+        T scratch = T();
+        return convert(value, &scratch);
+    }
+
+    /**
+     * @brief Creates an empty default, for the member.
+     */
+    static SmartOptionsDefault initial() {
+        return SmartOptionsDefault::For<T>();
+    }
+};
+
+/**
+ * @brief bool members are flags, set when the option is passed.
+ */
+template <>
+struct SmartOptionsMemberTraits<bool> {
+    static constexpr bool IS_FLAG = true;
+
+    static SMARTOPTIONS_STATUS convert(const char *, void *member) {
+        *static_cast<bool *>(member) = true;
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    static SMARTOPTIONS_STATUS check(const char *) {
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    static SmartOptionsDefault initial() {
+        return SmartOptionsDefault::For<bool>();
+    }
+};
+
+/**
+ * @brief const char * members point to the value on the command line.
+ */
+template <>
+struct SmartOptionsMemberTraits<const char *> {
+    static constexpr bool IS_FLAG = false;
+
+    static SMARTOPTIONS_STATUS convert(const char *value, void *member) {
+        *static_cast<const char **>(member) = value;
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    static SMARTOPTIONS_STATUS check(const char *) {
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    static SmartOptionsDefault initial() {
+        return SmartOptionsDefault::For<const char *>();
+    }
+};
+
+/** @endcond */
+
+/**
+ * @brief An entry of the member table of a bound struct, see SmartOptionsStructBinding.
+ */
+struct SmartOptionsMember {
+    char prefixShort;           //!< @brief A single character used to specify the option, POSIX style. 0 for a positional member.
+    const char *prefixLong;     //!< @brief The string used to specify the option, GNU style.
+    const char *metaVariable;   //!< @brief The string which specifies the different option values.
+    const char *helpString;     //!< @brief The string which explains the option in context.
+    size_t offset;              //!< @brief The offset of the member within the struct.
+    bool isFlag;                //!< @brief true if the member is set without a value (bool members).
+    SMARTOPTIONS_STATUS (*convert)(const char *value, void *member);   //!< @brief Converts a value into the member.
+    SMARTOPTIONS_STATUS (*check)(const char *value);                   //!< @brief Checks a value, without writing the member.
+    SmartOptionsDefault (*initial)();                                  //!< @brief Creates the default of the member.
+};
+
+/**
+ * @brief The result of SmartOptionsStructBinding::Scan(): the value of each member, before conversion.
+ */
+template <size_t N>
+struct SmartOptionsScanResult {
+    SMARTOPTIONS_STATUS status;     //!< @brief SMARTOPTIONS_SUCCESS, or the reason why the scan failed.
+    const char *reason;             //!< @brief A description of the failure, NULL on success.
+    int errorIndex;                 //!< @brief The index of the offending command line parameter, -1 if none.
+    const char *values[N];          //!< @brief The value of each member, "" for flags, NULL if not passed.
+    int indexes[N];                 //!< @brief The index of the command line parameter of each value, 0 if not passed.
+
+    /**
+     * @brief Returns true if the member has been passed on the command line.
+     */
+    constexpr bool IsSet(size_t member) const {
+        return member < N && NULL != this->values[member];
+    }
+
+    /**
+     * @brief Returns the value of a member, empty if the member has not been passed.
+     */
+    constexpr std::string_view Value(size_t member) const {
+        return this->IsSet(member) ? std::string_view(this->values[member]) : std::string_view();
+    }
+
+    /** @cond INTERNAL */
+    constexpr SmartOptionsScanResult fail(SMARTOPTIONS_STATUS status, const char *reason, int errorIndex) {
+        this->status = status;
+        this->reason = reason;
+        this->errorIndex = errorIndex;
+        return *this;
+    }
+    /** @endcond */
+};
+
+/**
+ * @brief Declares an option bound to a member of a plain (standard layout) struct, in a member table.
+ *
+ * @details bool members are flags, const char * members receive the value as is, and members of any other type
+ * are converted through SmartOptionsConverter.
+ */
+#define SMARTOPTIONS_MEMBER(STRUCT, MEMBER, PREFIX_SHORT, PREFIX_LONG, META_VARIABLE, HELP_STRING) \
+    SmartOptionsMember { PREFIX_SHORT, PREFIX_LONG, META_VARIABLE, HELP_STRING, offsetof(STRUCT, MEMBER), \
+                         SmartOptionsMemberTraits<decltype(STRUCT::MEMBER)>::IS_FLAG, \
+                         &SmartOptionsMemberTraits<decltype(STRUCT::MEMBER)>::convert, \
+                         &SmartOptionsMemberTraits<decltype(STRUCT::MEMBER)>::check, \
+                         &SmartOptionsMemberTraits<decltype(STRUCT::MEMBER)>::initial }
+
+/**
+ * @brief Declares a positional argument bound to a member of a plain struct, in a member table.
+ */
+#define SMARTOPTIONS_POSITIONAL_MEMBER(STRUCT, MEMBER, META_VARIABLE, HELP_STRING) \
+    SMARTOPTIONS_MEMBER(STRUCT, MEMBER, 0, NULL, META_VARIABLE, HELP_STRING)
+
+/**
+ * @brief Binds the command line to the members of a plain struct, through a constexpr table of member offsets.
+ *
+ * @details The binding holds no per-member pointers: Parse() writes into the struct passed to it, through the
+ * offsets of the table, and does not modify the binding. A binding can therefore fill many copies of the struct,
+ * from different command lines, concurrently.
+ *
+ * @code
+    struct Config {
+        const char *name;
+        int level;
+        double ratio;
+        bool verbose;
+    };
+
+    static constexpr SmartOptionsMember configMembers[] = {
+        SMARTOPTIONS_MEMBER(Config, level, 'l', "level", "LEVEL", "The level."),
+        SMARTOPTIONS_MEMBER(Config, ratio, 'r', "ratio", "RATIO", "The ratio."),
+        SMARTOPTIONS_MEMBER(Config, verbose, 'v', "verbose", NULL, "Verbose output."),
+        SMARTOPTIONS_POSITIONAL_MEMBER(Config, name, "NAME", "The name."),
+    };
+    static constexpr SmartOptionsStructBinding<Config, 4> configBinding(configMembers);
+
+    Config config = Config();
+    SMARTOPTIONS_STATUS status = configBinding.Parse(argc, argv, config);
+   @endcode
+ */
+template <typename S, size_t N>
+class SmartOptionsStructBinding {
+public:
+    /**
+     * @brief The Constructor, indexes the member table by option character.
+     *
+     * @param members The member table. Must outlive the binding.
+     */
+    constexpr SmartOptionsStructBinding(const SmartOptionsMember (&members)[N])
+    : members(members),
+      shortIndex(),
+      positionalCount(0)
+    {
+        static_assert(N < 255, "SmartOptionsStructBinding supports at most 254 members");
+        for (size_t i = 0; i < N; i++) {
+            if (0 == members[i].prefixShort) {
+                this->positionalCount++;
+            } else {
+                this->shortIndex[(uint8_t)members[i].prefixShort] = (uint8_t)(i + 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Processes a command line into a struct. Thread safe, the binding is not modified.
+     *
+     * @details The values are converted in command line order, every occurrence of a repeated option is converted
+     * into its member, so members whose SmartOptionsConverter accumulates values (a feature set, a prefix table)
+     * receive all of them, and the last occurrence wins for the others.
+     *
+     * @param argc The number of command line parameters that are there in the argv array.
+     * @param argv The string array which contains all the command line parameters passed.
+     * @param result The struct, whose members are set. Members of options which are not passed are untouched.
+     * @param errMessage Receives a description of the error, if not NULL.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if successful.
+     * @retval SMARTOPTIONS_INVALID_ARGUMENT if an unknown option, or an option without its value, is passed.
+     * @retval SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS if the number of positional arguments does not match.
+     * @retval Any error returned by the SmartOptionsConverter of a member.
+     */
+    SMARTOPTIONS_STATUS Parse(int argc, const char **argv, S &result, std::string *errMessage = NULL) const {
+        char *base = reinterpret_cast<char *>(&result);
+        const char *invalidValue = NULL;
+        const char *reason = NULL;
+        int errorIndex = -1;
+
+        SMARTOPTIONS_STATUS status = this->walk(argc, argv,
+            [&](size_t member, const char *value, int, const char *&failure) {
+                SMARTOPTIONS_STATUS convertStatus = this->members[member].convert(value, base + this->members[member].offset);
+                if (SMARTOPTIONS_SUCCESS != convertStatus) {
+                    failure = "invalid value";
+                    invalidValue = value;
+                }
+                return convertStatus;
+            }, reason, errorIndex);
+
+        if (SMARTOPTIONS_SUCCESS != status) {
+            return fail(errMessage, status, reason, invalidValue ? invalidValue : (errorIndex > 0 ? argv[errorIndex] : NULL));
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Assigns the tokens of a command line to the members, without converting any value.
+     *
+     * @details Scan() is usable in constant expressions, so a command line known at compile time (a test case, or a
+     * default command line embedded into the program) is scanned by the compiler, and its result can be checked
+     * with static_assert() or applied at run time with Apply(). Only the scan is evaluated by the compiler, the
+     * values are converted by Apply(), at run time.
+     *
+     * A scan holds a single value per member, so an option which takes a value may be passed only once; use Parse()
+     * for command lines which repeat options. Flags may be repeated.
+     *
+     * @code
+    static constexpr const char *defaultArgs[] = { "app", "-l", "3", "default-name" };
+    static constexpr auto defaults = configBinding.Scan(4, defaultArgs);
+    static_assert(SMARTOPTIONS_SUCCESS == defaults.status, "invalid default command line");
+
+    Config config = Config();
+    configBinding.Apply(defaults, config);
+       @endcode
+     *
+     * @param argc The number of command line parameters that are there in the argv array.
+     * @param argv The string array which contains all the command line parameters passed.
+     *
+     * @returns The value of each member, and the status of the scan: SMARTOPTIONS_INVALID_ARGUMENT if an unknown
+     * option, an option without its value or a repeated option is passed, SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS if
+     * the number of positional arguments does not match.
+     */
+    constexpr SmartOptionsScanResult<N> Scan(int argc, const char *const *argv) const {
+        SmartOptionsScanResult<N> result = {};
+        const char *reason = NULL;
+        int errorIndex = -1;
+
+        SMARTOPTIONS_STATUS status = this->walk(argc, argv,
+            [&result, this](size_t member, const char *value, int index, const char *&failure) {
+                if (NULL != result.values[member] && !this->members[member].isFlag) {
+                    failure = "repeated option";
+                    return SMARTOPTIONS_INVALID_ARGUMENT;
+                }
+                result.values[member] = value;
+                result.indexes[member] = index;
+                return SMARTOPTIONS_SUCCESS;
+            }, reason, errorIndex);
+
+        if (SMARTOPTIONS_SUCCESS != status) {
+            return result.fail(status, reason, errorIndex);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Converts the values of a successful Scan() into the members of a struct, in command line order.
+     *
+     * @param scan The result of Scan().
+     * @param result The struct, whose members are set. Members which have no value in the scan are untouched.
+     * @param errMessage Receives a description of the error, if not NULL.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if successful.
+     * @retval Any error returned by the SmartOptionsConverter of a member, or the status of a failed scan.
+     */
+    SMARTOPTIONS_STATUS Apply(const SmartOptionsScanResult<N> &scan, S &result, std::string *errMessage = NULL) const {
+        if (SMARTOPTIONS_SUCCESS != scan.status) {
+            return fail(errMessage, scan.status, scan.reason, NULL);
+        }
+
+        // Order the passed members by the position of their value, members are few...
+        size_t order[N > 0 ? N : 1];
+        size_t count = 0;
+        for (size_t member = 0; member < N; member++) {
+            if (NULL == scan.values[member]) continue;
+            size_t slot = count++;
+            for (; slot > 0 && scan.indexes[order[slot - 1]] > scan.indexes[member]; slot--) {
+                order[slot] = order[slot - 1];
+            }
+            order[slot] = member;
+        }
+
+        char *base = reinterpret_cast<char *>(&result);
+        for (size_t i = 0; i < count; i++) {
+            size_t member = order[i];
+            SMARTOPTIONS_STATUS status = this->members[member].convert(scan.values[member], base + this->members[member].offset);
+            if (SMARTOPTIONS_SUCCESS != status) {
+                return fail(errMessage, status, "invalid value", scan.values[member]);
+            }
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Returns the index of the member of an option, usable in constant expressions.
+     *
+     * @param prefixShort The character of the option.
+     *
+     * @returns The index of the member in the member table, N if there is no such option.
+     */
+    constexpr size_t IndexOf(char prefixShort) const {
+        return (0 == this->shortIndex[(uint8_t)prefixShort]) ? N : (size_t)(this->shortIndex[(uint8_t)prefixShort] - 1);
+    }
+
+    /**
+     * @brief Returns the member table.
+     */
+    constexpr const SmartOptionsMember *Members() const {
+        return this->members;
+    }
+
+private:
+    /**
+     * @brief Assigns the tokens of a command line to the members, in command line order, and checks the number of
+     * positional arguments. Shared by Parse() and Scan().
+     *
+     * @param visit Called with (member, value, index of the parameter, reason) for each value, "" for flags. A
+     * status other than SMARTOPTIONS_SUCCESS stops the walk, with the reason set by the visitor.
+     * @param reason Receives a description of the failure.
+     * @param errorIndex Receives the index of the offending command line parameter, -1 if none.
+     */
+    template <typename Visit>
+    constexpr SMARTOPTIONS_STATUS walk(int argc, const char *const *argv, Visit &&visit, const char *&reason, int &errorIndex) const {
+        size_t positionalIndex = 0;
+        size_t positionalSeen = 0;
+
+        for (int index = 1; index < argc; index++) {
+            const char *token = argv[index];
+            const char *value = NULL;
+            size_t member = N;
+
+            if ('-' == token[0] && '\0' != token[1]) {
+                uint8_t entry = this->shortIndex[(uint8_t)token[1]];
+                if (0 == entry) {
+                    reason = "invalid argument";
+                    errorIndex = index;
+                    return SMARTOPTIONS_INVALID_ARGUMENT;
+                }
+                member = entry - 1;
+                if (this->members[member].isFlag) {
+                    value = "";
+                } else if ('\0' != token[2]) {
+                    value = token + 2;
+                } else if (index + 1 < argc) {
+                    value = argv[++index];
+                } else {
+                    reason = "missing value for";
+                    errorIndex = index;
+                    return SMARTOPTIONS_INVALID_ARGUMENT;
+                }
+            } else {
+                positionalSeen++;
+                while (positionalIndex < N && 0 != this->members[positionalIndex].prefixShort) {
+                    positionalIndex++;
+                }
+                if (positionalIndex == N) continue;     // Reported below...
+                member = positionalIndex++;
+                value = token;
+            }
+
+            SMARTOPTIONS_STATUS status = visit(member, value, index, reason);
+            if (SMARTOPTIONS_SUCCESS != status) {
+                errorIndex = index;
+                return status;
+            }
+        }
+
+        if (positionalSeen != this->positionalCount) {
+            reason = "invalid number of mandatory arguments";
+            errorIndex = -1;
+            return SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS;
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Fills the error message, if requested, and returns the status.
+     */
+    static SMARTOPTIONS_STATUS fail(std::string *errMessage, SMARTOPTIONS_STATUS status, const char *reason, const char *token) {
+        if (errMessage) {
+            *errMessage = std::string("Error, ") + reason + (token ? std::string(" '") + token + "'" : std::string()) + ".";
+        }
+        return status;
+    }
+
+    const SmartOptionsMember *members;  //!< @brief The member table.
+    uint8_t shortIndex[256];            //!< @brief Option character to (member index + 1), 0 if unused.
+    size_t positionalCount;             //!< @brief The number of positional members.
+};
+
+/**
+ * @brief The version of the layout of SmartOptionsPluginTable and SmartOptionsMember, checked when a plugin is attached.
+ */
+#define SMARTOPTIONS_PLUGIN_ABI_VERSION 2
+
+/**
+ * @brief The name of the symbol, under which a plugin exports its SmartOptionsPluginTable.
+ */
+#define SMARTOPTIONS_PLUGIN_SYMBOL "SmartOptionsPluginTableExport"
+
+/**
+ * @brief The option table of a plugin (a shared object), built at compile time, see SMARTOPTIONS_EXPORT_PLUGIN and
+ * SmartOptions::AttachPlugin().
+ *
+ * @details The members are declared with SMARTOPTIONS_MEMBER, like for SmartOptionsStructBinding, and their values are
+ * written into the struct of the plugin. Positional members are not supported, the positional arguments belong to
+ * the host.
+ */
+struct SmartOptionsPluginTable {
+    uint32_t abiVersion;                //!< @brief SMARTOPTIONS_PLUGIN_ABI_VERSION, when the plugin was built.
+    const char *name;                   //!< @brief The name of the plugin.
+    const SmartOptionsMember *members;  //!< @brief The options of the plugin.
+    size_t memberCount;                 //!< @brief The number of options.
+    void *storage;                      //!< @brief The struct of the plugin, the options are written into.
+};
+
+/**
+ * @brief Exports the option table of a plugin, from one of its source files.
+ *
+ * @code
+    static PluginConfig pluginConfig;
+    static constexpr SmartOptionsMember pluginMembers[] = {
+        SMARTOPTIONS_MEMBER(PluginConfig, depth, 'd', "depth", "DEPTH", "The depth."),
+    };
+    SMARTOPTIONS_EXPORT_PLUGIN("example", pluginConfig, pluginMembers)
+   @endcode
+ */
+#if defined(_WIN32)
+#define SMARTOPTIONS_EXPORT_PLUGIN(NAME, STORAGE, MEMBERS) \
+    extern "C" __declspec(dllexport) const SmartOptionsPluginTable SmartOptionsPluginTableExport = \
+        { SMARTOPTIONS_PLUGIN_ABI_VERSION, NAME, MEMBERS, sizeof(MEMBERS) / sizeof(MEMBERS[0]), &(STORAGE) };
+#else
+#define SMARTOPTIONS_EXPORT_PLUGIN(NAME, STORAGE, MEMBERS) \
+    extern "C" __attribute__((visibility("default"))) const SmartOptionsPluginTable SmartOptionsPluginTableExport = \
+        { SMARTOPTIONS_PLUGIN_ABI_VERSION, NAME, MEMBERS, sizeof(MEMBERS) / sizeof(MEMBERS[0]), &(STORAGE) };
+#endif
+
+/**
+ * @brief Loads a plugin, and finds its option table, see SMARTOPTIONS_EXPORT_PLUGIN.
+ *
+ * @details The plugin is unloaded when this object is destroyed, which must happen after the SmartOptions the table
+ * is attached to.
+ */
+class SmartOptionsPlugin {
+public:
+    SmartOptionsPlugin() : handle(NULL), table(NULL) {}
+
+    ~SmartOptionsPlugin() {
+        this->Close();
+    }
+
+    SmartOptionsPlugin(const SmartOptionsPlugin &) = delete;
+    SmartOptionsPlugin &operator=(const SmartOptionsPlugin &) = delete;
+
+    /**
+     * @brief Loads a plugin.
+     *
+     * @param path The path of the shared object.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the plugin is loaded, see Table().
+     * @retval SMARTOPTIONS_INVALID_ARGUMENT if the plugin exports no option table, or one of another version.
+     * @retval SMARTOPTIONS_SYSTEM_ERROR if the shared object could not be loaded, see dlerror().
+     */
+    SMARTOPTIONS_STATUS Open(const char *path) {
+        this->Close();
+#if defined(_WIN32)
+        (void)path;
+        errno = ENOSYS;
+        return SMARTOPTIONS_SYSTEM_ERROR;
+#else
+        this->handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+        if (NULL == this->handle) return SMARTOPTIONS_SYSTEM_ERROR;
+
+        const SmartOptionsPluginTable *table = static_cast<const SmartOptionsPluginTable *>(dlsym(this->handle, SMARTOPTIONS_PLUGIN_SYMBOL));
+        if (NULL == table || SMARTOPTIONS_PLUGIN_ABI_VERSION != table->abiVersion) {
+            this->Close();
+            return SMARTOPTIONS_INVALID_ARGUMENT;
+        }
+        this->table = table;
+        return SMARTOPTIONS_SUCCESS;
+#endif
+    }
+
+    /**
+     * @brief Unloads the plugin, if one is loaded.
+     */
+    void Close() {
+#if !defined(_WIN32)
+        if (NULL != this->handle) dlclose(this->handle);
+#endif
+        this->handle = NULL;
+        this->table = NULL;
+    }
+
+    /**
+     * @brief Retrieves the option table of the plugin, NULL if none is loaded.
+     */
+    const SmartOptionsPluginTable *Table() const {
+        return this->table;
+    }
+
+private:
+    void *handle;                           //!< @brief The handle of the shared object.
+    const SmartOptionsPluginTable *table;   //!< @brief The option table of the plugin.
+};
+
+/**
+ * @brief A plugin table attached to SmartOptions, and the option ID of its first member.
+ * @cond INTERNAL
+ */
+struct SmartOptionsPluginLink {
+    const SmartOptionsPluginTable *table;   //!< @brief The option table.
+    unsigned firstId;                       //!< @brief The option ID of the first member, the others follow.
+};
+
+typedef std::pmr::vector<SmartOptionsPluginLink> SmartOptionsPluginLinkList;
+
+/** @endcond */
+
+/**
+ * @brief The checks which can be requested for a path option, combine them with '|'.
+ */
+typedef enum SMARTOPTIONS_PATH_CHECK {
+   SMARTOPTIONS_PATH_EXISTS          = 0x01,  /*!< The path must exist. */
+   SMARTOPTIONS_PATH_READABLE        = 0x02,  /*!< The path must exist and be readable. */
+   SMARTOPTIONS_PATH_DIRECTORY       = 0x04,  /*!< The path must exist and be a directory. */
+   SMARTOPTIONS_PATH_WRITABLE_PARENT = 0x08   /*!< The directory containing the path must exist and be writable (for output files). */
+} SMARTOPTIONS_PATH_CHECK;
+
+/** @cond INTERNAL */
+
+/**
+ * @brief The checks registered for a path option, evaluated once the command line has been processed.
+ */
+struct SmartOptionsPathCheck {
+    char prefixShort;           //!< @brief The option, used in error messages.
+    unsigned checks;            //!< @brief A combination of SMARTOPTIONS_PATH_CHECK values.
+    const char **destVariable;  //!< @brief The variable holding the path, NULL if the option was not passed.
+    unsigned id;                //!< @brief The option ID.
+};
+
+typedef std::pmr::list<SmartOptionsPathCheck> SmartOptionsPathCheckList;
+
+/**
+ * @brief Converts the value of an option into the destination variable.
+ *
+ * @param value The value string from the command line.
+ * @param destVariable A pointer, where the converted value is stored into.
+ * @param context Conversion specific data registered with the option (for example a choice table).
+ * @param errMessage Receives the reason, if the value is rejected.
+ *
+ * @returns SMARTOPTIONS_SUCCESS if the value is converted, an error code otherwise.
+ */
+typedef SMARTOPTIONS_STATUS (*SmartOptionsConvertFn)(const char *value, void *destVariable, const void *context, std::string &errMessage);
+
+/**
+ * @brief The class which holds a typed Command line option, whose value is converted before it is stored.
+ */
+struct SmartOptionsValueArg : public SmartOptionsArg {
+    /**
+     * @brief The Constructor.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param destVariable A pointer, where the converted value is stored into.
+     * @param convert The function which converts the value string.
+     * @param context Conversion specific data passed to the convert function.
+     */
+    template <typename T>
+    SmartOptionsValueArg(char prefixShort, const char *prefixLong,
+                         T *destVariable, SmartOptionsConvertFn convert, const void *context)
+    : SmartOptionsArg(prefixShort, prefixLong),
+      destVariable(destVariable),
+      convert(convert),
+      context(context),
+      check(&SmartOptionsValueArg::checkValue<T>),
+      hash(SmartOptionsValueArg::hashFunction<T>()),
+      initial(SmartOptionsDefault::For<T>())
+    {
+    }
+
+    /**
+     * @brief Checks a value of the option, by converting it into a scratch variable of the destination type, and
+     * hashes the canonical form of the scratch variable, see SmartOptionsCanonical.
+     *
+     * @param arg The option.
+     * @param value The value.
+     * @param errMessage Receives the reason, if the value is rejected.
+     * @param valueHash Receives the hash, if the option has a hash function and the value is valid.
+     */
+    template <typename T>
+    static SMARTOPTIONS_STATUS checkValue(const SmartOptionsValueArg &arg, const char *value, std::string &errMessage, uint64_t &valueHash) {
+        T scratch = T();
+        SMARTOPTIONS_STATUS status = arg.convert(value, &scratch, arg.context, errMessage);
+        if (SMARTOPTIONS_SUCCESS == status && NULL != arg.hash) valueHash = arg.hash(&scratch);
+        return status;
+    }
+
+    /**
+     * @brief Hashes the canonical form of a converted value, see SmartOptionsCanonical.
+     */
+    template <typename T>
+    static uint64_t hashValue(const void *value) {
+        return SmartOptionsCanonical<T>::Hash(*static_cast<const T *>(value));
+    }
+
+    /**
+     * @brief Retrieves hashValue() for T, NULL if T has no canonical form, or can not be copied into the scratch
+     * value of a repeatable option, see SmartOptions::Parse().
+     */
+    template <typename T>
+    static uint64_t (*hashFunction())(const void *value) {
+        if constexpr (SmartOptionsCanonical<T>::IS_CANONICAL && std::is_copy_constructible<T>::value && std::is_copy_assignable<T>::value) {
+            return &SmartOptionsValueArg::hashValue<T>;
+        } else {
+            return NULL;
+        }
+    }
+
+    // Member Variables
+    void *destVariable;             //!< @brief A pointer, where the converted value is stored into.
+    SmartOptionsConvertFn convert;  //!< @brief The function which converts the value string.
+    const void *context;            //!< @brief Conversion specific data passed to the convert function.
+    SMARTOPTIONS_STATUS (*check)(const SmartOptionsValueArg &arg, const char *value,
+                                 std::string &errMessage, uint64_t &valueHash);  //!< @brief Checks a value, without updating the variable.
+    uint64_t (*hash)(const void *value);    //!< @brief Hashes a converted value, NULL if the type has no canonical form.
+    SmartOptionsDefault initial;    //!< @brief The empty default of the variable, copied into the target of the option.
+};
+
+typedef std::pmr::list<SmartOptionsValueArg> SmartOptionsValueArgList;
+
+/**
+ * @brief The variable of an option, whatever its kind, so that the variables of the options touched by an edit
+ * are found by their option IDs.
+ */
+struct SmartOptionsTarget {
+    void *variable;                 //!< @brief The variable, or the member of a plugin.
+    SmartOptionsConvertFn convert;  //!< @brief Converts a value into the variable, NULL if the value string is stored as is.
+    const void *context;            //!< @brief Conversion specific data passed to the convert function.
+    SmartOptionsDefault initial;    //!< @brief The value of the variable before the first command line was processed.
+};
+
+typedef std::pmr::vector<SmartOptionsTarget> SmartOptionsTargetList;
+
+/**
+ * @brief The value the values of a repeatable option accumulate into, while a command line is only parsed, see
+ * SmartOptions::Parse().
+ */
+struct SmartOptionsScratch {
+    unsigned id;                    //!< @brief The option ID.
+    std::shared_ptr<void> value;    //!< @brief The value, starting from the default of the variable.
+};
+
+typedef std::vector<SmartOptionsScratch> SmartOptionsScratchList;
+
+/** @endcond */
+
+/**
+ * @brief The kinds of command line parameters, see SmartOptionsEntry.
+ */
+typedef enum SMARTOPTIONS_ARG_KIND {
+   SMARTOPTIONS_ARG_FLAG        = 0x00,  /*!< A flag, added with AddFlag(). */
+   SMARTOPTIONS_ARG_OPTION,              /*!< A string option, added with AddOption(). */
+   SMARTOPTIONS_ARG_VALUE,               /*!< A typed option, whose value is converted before it is stored. */
+   SMARTOPTIONS_ARG_POSITIONAL           /*!< A positional argument, added with AddPositionalArgument(). */
+} SMARTOPTIONS_ARG_KIND;
+
+/**
+ * @brief The places a value can come from, see SmartOptionsResult.
+ */
+typedef enum SMARTOPTIONS_SOURCE {
+   SMARTOPTIONS_SOURCE_DEFAULT      = 0x00,  /*!< The option was not passed, its variable keeps the default value. */
+   SMARTOPTIONS_SOURCE_COMMAND_LINE,         /*!< The value was passed on the command line. */
+   SMARTOPTIONS_SOURCE_ENVIRONMENT,          /*!< The value was passed in an environment variable, see SmartOptionsTokenChain. */
+   SMARTOPTIONS_SOURCE_RESPONSE_FILE         /*!< The value was passed in a response file, see SmartOptionsTokenChain. */
+} SMARTOPTIONS_SOURCE;
+
+/**
+ * @brief Describes an option added to SmartOptions, indexed by the option ID.
+ */
+struct SmartOptionsEntry {
+    SMARTOPTIONS_ARG_KIND kind;     //!< @brief The kind of the option.
+    char prefixShort;               //!< @brief The single character used to specify the option, 0 for positional arguments.
+    const char *prefixLong;         //!< @brief The string used to specify the option, GNU style, may be NULL.
+    bool isRepeatable;              //!< @brief Every value of the option counts, not only the last one (like feature sets).
+    uint64_t key;                   //!< @brief Identifies the option in fingerprints: a hash of the short prefix, or of the meta variable for positional arguments.
+};
+
+/**
+ * @brief The text describing an option, indexed by the option ID.
+ *
+ * @details Only the help and the error messages read it, so it is kept out of the option records,
+ * which are walked for every command line parameter.
+ */
+struct SmartOptionsHelpText {
+    const char *metaVariable;   //!< @brief The string which specifies the different option values, NULL for flags.
+    const char *helpString;     //!< @brief The string which explains the option in context.
+};
+
+typedef std::pmr::vector<SmartOptionsHelpText> SmartOptionsHelpTextList;
+
+/**
+ * @brief A trigram index over the long prefixes, the meta variables and the help strings of the options, see
+ * SmartOptions::BuildHelpIndex().
+ *
+ * @details Every lower cased trigram maps to the sorted IDs of the options whose text contains it. The postings of all
+ * the trigrams share a single array, so the index takes three allocations whatever the number of options.
+ * @cond INTERNAL
+ */
+class SmartOptionsHelpIndex {
+public:
+    /**
+     * @brief The Constructor, of an empty index.
+     */
+    SmartOptionsHelpIndex()
+    : optionCount(0)
+    {
+    }
+
+    /**
+     * @brief Indexes the text of all the options.
+     *
+     * @param entries The description of the options, indexed by the option ID.
+     * @param texts The help text of the options, indexed by the option ID.
+     */
+    void Build(const std::pmr::vector<SmartOptionsEntry> &entries, const SmartOptionsHelpTextList &texts) {
+        std::vector<uint64_t> pairs;    // The trigram in the high half, the option ID in the low half.
+        for (size_t id = 0; id < texts.size(); id++) {
+            SmartOptionsHelpIndex::addTrigrams(entries[id].prefixLong, (unsigned)id, pairs);
+            SmartOptionsHelpIndex::addTrigrams(texts[id].metaVariable, (unsigned)id, pairs);
+            SmartOptionsHelpIndex::addTrigrams(texts[id].helpString, (unsigned)id, pairs);
+        }
+
+        // The pairs are generated in the order of the option IDs, so a stable radix sort on the trigram sorts them...
+        std::vector<uint64_t> sorted(pairs.size());
+        for (unsigned shift = 32; shift < 56; shift += 8) {
+            size_t counts[257] = {0};
+            for (size_t index = 0; index < pairs.size(); index++) counts[((pairs[index] >> shift) & 0xFF) + 1]++;
+            for (size_t digit = 1; digit < 257; digit++) counts[digit] += counts[digit - 1];
+            for (size_t index = 0; index < pairs.size(); index++) sorted[counts[(pairs[index] >> shift) & 0xFF]++] = pairs[index];
+            pairs.swap(sorted);
+        }
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+        this->Clear();
+        this->ids.reserve(pairs.size());
+        for (size_t index = 0; index < pairs.size(); index++) {
+            uint32_t trigram = (uint32_t)(pairs[index] >> 32);
+            if (this->trigrams.empty() || this->trigrams.back() != trigram) {
+                this->trigrams.push_back(trigram);
+                this->offsets.push_back((uint32_t)index);
+            }
+            this->ids.push_back((unsigned)pairs[index]);
+        }
+        this->offsets.push_back((uint32_t)pairs.size());
+        this->optionCount = texts.size();
+    }
+
+    /**
+     * @brief Empties the index.
+     */
+    void Clear() {
+        this->trigrams.clear();
+        this->offsets.clear();
+        this->ids.clear();
+        this->optionCount = 0;
+    }
+
+    /**
+     * @brief Retrieves the number of options indexed, 0 if the index was not built.
+     */
+    size_t OptionCount() const {
+        return this->optionCount;
+    }
+
+    /**
+     * @brief Retrieves the options, whose text contains a trigram.
+     *
+     * @param trigram The three characters, lower cased.
+     * @param count Receives the number of options.
+     *
+     * @returns The sorted option IDs, NULL if there are none.
+     */
+    const unsigned *Find(const char *trigram, size_t &count) const {
+        uint32_t key = SmartOptionsHelpIndex::pack(trigram);
+        std::vector<uint32_t>::const_iterator it = std::lower_bound(this->trigrams.begin(), this->trigrams.end(), key);
+        count = 0;
+        if (it == this->trigrams.end() || *it != key) return NULL;
+
+        size_t slot = it - this->trigrams.begin();
+        count = this->offsets[slot + 1] - this->offsets[slot];
+        return &this->ids[this->offsets[slot]];
+    }
+
+    /**
+     * @brief Retrieves the number of bytes allocated by the index.
+     */
+    size_t MemoryFootprint() const {
+        return this->trigrams.capacity() * sizeof(uint32_t) + this->offsets.capacity() * sizeof(uint32_t) +
+               this->ids.capacity() * sizeof(unsigned);
+    }
+
+private:
+    /**
+     * @brief Packs three lower cased characters into a key.
+     */
+    static uint32_t pack(const char *trigram) {
+        return ((uint32_t)(unsigned char)tolower((unsigned char)trigram[0]) << 16) |
+               ((uint32_t)(unsigned char)tolower((unsigned char)trigram[1]) << 8) |
+               (uint32_t)(unsigned char)tolower((unsigned char)trigram[2]);
+    }
+
+    /**
+     * @brief Adds the trigrams of a text, NULL texts have none.
+     */
+    static void addTrigrams(const char *text, unsigned id, std::vector<uint64_t> &pairs) {
+        if (NULL == text) return;
+        for (size_t length = strlen(text), index = 0; index + 3 <= length; index++) {
+            pairs.push_back(((uint64_t)SmartOptionsHelpIndex::pack(text + index) << 32) | id);
+        }
+    }
+
+    // Member Variables
+    std::vector<uint32_t> trigrams;     //!< @brief The distinct trigrams, sorted.
+    std::vector<uint32_t> offsets;      //!< @brief The first posting of each trigram, followed by the number of postings.
+    std::vector<unsigned> ids;          //!< @brief The postings: the option IDs of each trigram, sorted.
+    size_t optionCount;                 //!< @brief The number of options, when the index was built.
+};
+
+/** @endcond */
+
+/**
+ * @brief The memory used by SmartOptions, in bytes, see SmartOptions::MemoryFootprint().
+ *
+ * @details The allocator overhead is not counted, except for the two links of every std::list node. The names and the
+ * help text are the strings passed when adding the options, which are referenced rather than copied.
+ */
+struct SmartOptionsMemoryFootprint {
+    size_t records;     //!< @brief The SmartOptions object, the option records and the entries.
+    size_t names;       //!< @brief The long prefixes referenced by the options.
+    size_t indexes;     //!< @brief The help index, and the hit counters if SMARTOPTIONS_TELEMETRY is defined.
+    size_t help;        //!< @brief The help text table, with the meta variables and the help strings it references.
+    size_t arena;       //!< @brief The arena holding the strings created from the command line.
+    size_t result;      //!< @brief The result of the last ProcessCommandArgs(), see SmartOptionsResult::MemoryFootprint().
+
+    /**
+     * @brief Retrieves the sum of all the parts.
+     */
+    size_t Total() const {
+        return this->records + this->names + this->indexes + this->help + this->arena + this->result;
+    }
+};
+
+/**
+ * @brief Selects options, see SmartOptions::BuildArgv().
+ *
+ * @param id The option ID.
+ * @param entry The description of the option.
+ * @param context The context passed along with the filter.
+ *
+ * @returns true if the option is selected.
+ */
+typedef bool (*SmartOptionsFilterFn)(unsigned id, const SmartOptionsEntry &entry, const void *context);
+
+/**
+ * @brief A single value bound while processing the command line.
+ */
+struct SmartOptionsBinding {
+    unsigned id;                    //!< @brief The option ID.
+    SMARTOPTIONS_SOURCE source;     //!< @brief Where the value comes from.
+    const char *value;              //!< @brief The value string as passed, NULL for flags.
+    size_t next;                    //!< @brief The storage index + 1 of the next binding of the same option, 0 if none, see SmartOptionsResult::NextBinding().
+    size_t previous;                //!< @brief The storage index + 1 of the previous binding of the same option, 0 if none.
+    int index;                      //!< @brief The index of the command line parameter, which passes the option, when it was bound, see SmartOptionsResult::ParameterIndex().
+    int tokenCount;                 //!< @brief The number of command line parameters taken, 2 if the value is passed separately.
+    uint64_t valueHash;             //!< @brief The hash of the value, kept for the fingerprints.
+    uint64_t optionHash;            //!< @brief The fingerprint of the option, once this value is bound.
+};
+
+/**
+ * @brief The ways a command line can be edited, see SmartOptions::ProcessCommandArgsEdit().
+ */
+typedef enum SMARTOPTIONS_EDIT {
+   SMARTOPTIONS_EDIT_INSERT     = 0x00,  /*!< A parameter has been inserted at the index. */
+   SMARTOPTIONS_EDIT_REPLACE,            /*!< The parameter at the index has been replaced. */
+   SMARTOPTIONS_EDIT_DELETE              /*!< The parameter at the index has been deleted. */
+} SMARTOPTIONS_EDIT;
+
+/** @cond INTERNAL */
+
+/**
+ * @brief The layout of an encoded result, see SmartOptionsResult::Encode().
+ *
+ * @details All the fields are unsigned integers in host byte order, the offsets are relative to the start of
+ * the encoding, so it can be used wherever it is received or mapped:
+ * - the header: magic, version, option count, binding count, string blob size, reserved (6 x 32 bit),
+ * - the seen bits, one 64 bit word per 64 options,
+ * - per option, the index + 1 of its last binding, 0 if none (32 bit),
+ * - per binding: option ID, source, value offset in the blob, value length, index + 1 of the next binding
+ *   of the same option (5 x 32 bit), the offset is NO_VALUE for flags,
+ * - the string blob, every value followed by a '\0'.
+ */
+struct SmartOptionsEncoding {
+    static constexpr uint32_t MAGIC = 0x314F5353;     //!< @brief "SSO1".
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t NO_VALUE = 0xFFFFFFFF;
+    static constexpr size_t HEADER_SIZE = 6 * sizeof(uint32_t);
+    static constexpr size_t BINDING_SIZE = 5 * sizeof(uint32_t);
+
+    static uint32_t load32(const char *data) {
+        uint32_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static uint64_t load64(const char *data) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static char *store32(char *data, uint32_t value) {
+        memcpy(data, &value, sizeof(value));
+        return data + sizeof(value);
+    }
+
+    static char *store64(char *data, uint64_t value) {
+        memcpy(data, &value, sizeof(value));
+        return data + sizeof(value);
+    }
+};
+
+/** @endcond */
+
+/**
+ * @brief The result of processing a command line: which options have been passed, and with what values.
+ *
+ * @details The values point into the processed command line, which must outlive the result. Options which are
+ * passed more than once (like feature sets) keep all of their values, in command line order.
+ */
+class SmartOptionsResult {
+public:
+    /**
+     * @brief The Constructor, of an empty result using the default memory resource.
+     */
+    SmartOptionsResult() {}
+
+    /**
+     * @brief The Constructor, of an empty result.
+     *
+     * @param resource The memory resource, the bindings and the per option arrays are allocated from.
+     */
+    explicit SmartOptionsResult(std::pmr::memory_resource *resource)
+    : seen(resource),
+      firstBindings(resource),
+      lastBindings(resource),
+      hashes(resource),
+      bindings(resource)
+    {
+    }
+
+    /**
+     * @brief Retrieves the number of options, the valid option IDs are 0 to OptionCount() - 1.
+     */
+    size_t OptionCount() const {
+        return this->lastBindings.size();
+    }
+
+    /**
+     * @brief Checks whether an option has been passed.
+     *
+     * @param id The option ID.
+     */
+    bool IsSet(unsigned id) const {
+        return id < this->lastBindings.size() && 0 != ((this->seen[id / 64] >> (id % 64)) & 1);
+    }
+
+    /**
+     * @brief Retrieves where the value of an option comes from.
+     *
+     * @param id The option ID.
+     */
+    SMARTOPTIONS_SOURCE Source(unsigned id) const {
+        return this->IsSet(id) ? this->bindings[this->lastBindings[id] - 1].source : SMARTOPTIONS_SOURCE_DEFAULT;
+    }
+
+    /**
+     * @brief Retrieves the last value passed for an option.
+     *
+     * @param id The option ID.
+     *
+     * @returns The value string, or NULL if the option has not been passed or is a flag.
+     */
+    const char *Value(unsigned id) const {
+        return this->IsSet(id) ? this->bindings[this->lastBindings[id] - 1].value : NULL;
+    }
+
+    /**
+     * @brief Retrieves the first value bound to an option, see NextBinding().
+     *
+     * @param id The option ID.
+     *
+     * @returns The binding, or NULL if the option has not been passed.
+     */
+    const SmartOptionsBinding *FirstBinding(unsigned id) const {
+        return this->IsSet(id) ? &this->bindings[this->firstBindings[id] - 1] : NULL;
+    }
+
+    /**
+     * @brief Retrieves the next value bound to the same option.
+     *
+     * @param binding A binding of this result.
+     *
+     * @returns The binding, or NULL if there is none.
+     */
+    const SmartOptionsBinding *NextBinding(const SmartOptionsBinding *binding) const {
+        return (0 != binding->next) ? &this->bindings[binding->next - 1] : NULL;
+    }
+
+    /**
+     * @brief Retrieves the fingerprint of the effective configuration.
+     *
+     * @details Two results have the same fingerprint when the same options are passed with the same effective
+     * values, whatever their order: for most options only the last value counts, for repeatable ones (like
+     * feature sets) the value all of them accumulate into. Typed values are hashed by their converted value, so
+     * 1.0 and 1.00, or -f a,b and -f a -f b, count the same, see SmartOptionsCanonical. Where the values come
+     * from does not count. The fingerprint is stable across runs and builds, and is maintained while the values
+     * are bound: a typed value is hashed once converted into its variable, the value of a repeatable option once
+     * each value is added to it, starting from the default of the variable; Parse() converts into a scratch copy
+     * of the default instead.
+     */
+    uint64_t Fingerprint() const {
+        return SmartOptionsHashFinalize(this->fingerprint);
+    }
+
+    /**
+     * @brief Retrieves the fingerprint of the effective value of a single option, 0 if it has not been passed.
+     *
+     * @param id The option ID.
+     */
+    uint64_t OptionFingerprint(unsigned id) const {
+        return (id < this->hashes.size()) ? this->hashes[id] : 0;
+    }
+
+    /**
+     * @brief Finds the options, whose effective value differs between two results, for example to reapply only
+     * the changed settings when the configuration is reloaded.
+     *
+     * @details The options passed in either result are found through their seen bits, and compared by their
+     * fingerprints, see OptionFingerprint(). The cost is linear in the number of options passed in either result
+     * (plus a word per 64 options), not in the number of changed ones: two results share no record of what
+     * changed between them, so an unchanged option passed in both is compared all the same.
+     *
+     * @param other A result of processing another command line with the same options.
+     * @param changed Receives the IDs of the changed options, in increasing order.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the results are compared.
+     * @retval SMARTOPTIONS_INVALID_ARGUMENT if the results do not have the same options.
+     */
+    SMARTOPTIONS_STATUS Diff(const SmartOptionsResult &other, std::vector<unsigned> &changed) const {
+        changed.clear();
+        if (this->hashes.size() != other.hashes.size()) return SMARTOPTIONS_INVALID_ARGUMENT;
+
+        for (size_t index = 0; index < this->seen.size(); index++) {
+            for (uint64_t word = this->seen[index] | other.seen[index]; 0 != word; word &= word - 1) {
+                size_t id = index * 64 + SmartOptionsLowestBit(word);
+                if (this->hashes[id] != other.hashes[id]) changed.push_back((unsigned)id);
+            }
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Retrieves the number of values bound.
+     */
+    size_t BindingCount() const {
+        return this->bindings.size() - (this->gapEnd - this->gapStart);
+    }
+
+    /**
+     * @brief Retrieves a value bound, in command line order.
+     *
+     * @param position The position of the binding, less than BindingCount().
+     */
+    const SmartOptionsBinding &Binding(size_t position) const {
+        return this->bindings[this->slotOf(position)];
+    }
+
+    /**
+     * @brief Retrieves the index of the command line parameter, which passes the value of a binding.
+     *
+     * @details The index stored in a binding is the one it was bound with; the bindings after an edit keep it,
+     * and are shifted here, see SmartOptions::ProcessCommandArgsEdit().
+     *
+     * @param binding A binding of this result.
+     */
+    int ParameterIndex(const SmartOptionsBinding *binding) const {
+        return binding->index + (((size_t)(binding - this->bindings.data()) >= this->gapEnd) ? this->tailDelta : 0);
+    }
+
+    /**
+     * @brief Retrieves the number of bytes used by the result: the object, its bindings and its per option arrays.
+     *
+     * @details The values are not counted, they point into the command line or into the arena of SmartOptions.
+     */
+    size_t MemoryFootprint() const {
+        return sizeof(SmartOptionsResult) + this->seen.capacity() * sizeof(uint64_t) +
+               this->firstBindings.capacity() * sizeof(size_t) + this->lastBindings.capacity() * sizeof(size_t) +
+               this->hashes.capacity() * sizeof(uint64_t) + this->bindings.capacity() * sizeof(SmartOptionsBinding);
+    }
+
+    /**
+     * @brief Retrieves the number of bytes needed to encode the result, see Encode().
+     */
+    size_t EncodedSize() const {
+        size_t size = SmartOptionsEncoding::HEADER_SIZE + this->seen.size() * sizeof(uint64_t)
+                    + this->lastBindings.size() * sizeof(uint32_t) + this->BindingCount() * SmartOptionsEncoding::BINDING_SIZE;
+        for (size_t position = 0; position < this->BindingCount(); position++) {
+            if (NULL != this->Binding(position).value) size += strlen(this->Binding(position).value) + 1;
+        }
+        return size;
+    }
+
+    /**
+     * @brief Encodes the result into a compact, position independent buffer, for example to hand it over to
+     * another process. The receiver uses the buffer in place with SmartOptionsResultView.
+     *
+     * @param buffer The buffer, which receives the encoding.
+     * @param size The size of the buffer, at least EncodedSize() bytes.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the result is encoded.
+     * @retval SMARTOPTIONS_INVALID_ARGUMENT if the buffer is too small.
+     * @retval SMARTOPTIONS_OUT_OF_RANGE if the values do not fit the 32 bit offsets of the encoding.
+     */
+    SMARTOPTIONS_STATUS Encode(void *buffer, size_t size) const {
+        size_t encodedSize = this->EncodedSize();
+        if (NULL == buffer || size < encodedSize) return SMARTOPTIONS_INVALID_ARGUMENT;
+        if (encodedSize > SmartOptionsEncoding::NO_VALUE) return SMARTOPTIONS_OUT_OF_RANGE;
+
+        char *out = (char *)buffer;
+        char *blob = out + SmartOptionsEncoding::HEADER_SIZE + this->seen.size() * sizeof(uint64_t)
+                   + this->lastBindings.size() * sizeof(uint32_t) + this->BindingCount() * SmartOptionsEncoding::BINDING_SIZE;
+        uint32_t blobSize = (uint32_t)(encodedSize - (blob - out));
+
+        out = SmartOptionsEncoding::store32(out, SmartOptionsEncoding::MAGIC);
+        out = SmartOptionsEncoding::store32(out, SmartOptionsEncoding::VERSION);
+        out = SmartOptionsEncoding::store32(out, (uint32_t)this->lastBindings.size());
+        out = SmartOptionsEncoding::store32(out, (uint32_t)this->BindingCount());
+        out = SmartOptionsEncoding::store32(out, blobSize);
+        out = SmartOptionsEncoding::store32(out, 0);
+        for (size_t index = 0; index < this->seen.size(); index++) {
+            out = SmartOptionsEncoding::store64(out, this->seen[index]);
+        }
+        for (size_t id = 0; id < this->lastBindings.size(); id++) {
+            out = SmartOptionsEncoding::store32(out, (uint32_t)this->linkPosition(this->lastBindings[id]));
+        }
+
+        uint32_t offset = 0;
+        for (size_t position = 0; position < this->BindingCount(); position++) {
+            const SmartOptionsBinding &binding = this->Binding(position);
+            uint32_t length = (NULL != binding.value) ? (uint32_t)strlen(binding.value) : 0;
+            out = SmartOptionsEncoding::store32(out, binding.id);
+            out = SmartOptionsEncoding::store32(out, binding.source);
+            out = SmartOptionsEncoding::store32(out, (NULL != binding.value) ? offset : SmartOptionsEncoding::NO_VALUE);
+            out = SmartOptionsEncoding::store32(out, length);
+            out = SmartOptionsEncoding::store32(out, (uint32_t)this->linkPosition(binding.next));
+            if (NULL != binding.value) {
+                memcpy(blob + offset, binding.value, length + 1);
+                offset += length + 1;
+            }
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /** @cond INTERNAL */
+
+    /**
+     * @brief Clears the result, before a command line is processed.
+     *
+     * @param optionCount The number of options.
+     */
+    void reset(size_t optionCount) {
+        this->seen.assign((optionCount + 63) / 64, 0);
+        this->firstBindings.assign(optionCount, 0);
+        this->lastBindings.assign(optionCount, 0);
+        this->hashes.assign(optionCount, 0);
+        this->bindings.clear();
+        this->gapStart = 0;
+        this->gapEnd = 0;
+        this->tailDelta = 0;
+        this->fingerprint = 0;
+    }
+
+    /**
+     * @brief Retrieves the position of a binding of this result, in command line order.
+     */
+    size_t position(const SmartOptionsBinding *binding) const {
+        return this->positionOf((size_t)(binding - this->bindings.data()));
+    }
+
+    /**
+     * @brief Retrieves the position, where the next binding is inserted, see moveGap().
+     */
+    size_t insertPosition() const {
+        return this->gapStart;
+    }
+
+    /**
+     * @brief Retrieves the binding which follows the inserted ones, NULL if none.
+     */
+    const SmartOptionsBinding *following() const {
+        return (this->gapEnd < this->bindings.size()) ? &this->bindings[this->gapEnd] : NULL;
+    }
+
+    /**
+     * @brief Moves the unused slots in front of a binding, where the bindings are then inserted and removed. The
+     * bindings between the previous and the new place of the slots are moved, the others stay in place.
+     *
+     * @param position The position of the binding, BindingCount() for the end.
+     */
+    void moveGap(size_t position) {
+        if (this->gapStart == this->gapEnd && 0 == this->tailDelta) {
+            this->gapStart = this->gapEnd = position;
+            return;
+        }
+        while (this->gapStart > position) {
+            this->gapStart--;
+            this->gapEnd--;
+            this->moveSlot(this->gapStart, this->gapEnd, -this->tailDelta);
+        }
+        while (this->gapStart < position) {
+            this->moveSlot(this->gapEnd, this->gapStart, this->tailDelta);
+            this->gapStart++;
+            this->gapEnd++;
+        }
+        if (this->gapEnd == this->bindings.size()) this->tailDelta = 0;
+    }
+
+    /**
+     * @brief Shifts the parameter indexes of the bindings which follow the inserted ones, see ParameterIndex().
+     */
+    void shiftFollowing(int delta) {
+        if (this->gapEnd < this->bindings.size()) this->tailDelta += delta;
+    }
+
+    /**
+     * @brief Removes the binding which follows the inserted ones, and updates the fingerprints.
+     */
+    void removeFollowing() {
+        const SmartOptionsBinding &binding = this->bindings[this->gapEnd];
+        unsigned id = binding.id;
+        if (0 != binding.previous) this->bindings[binding.previous - 1].next = binding.next;
+        else this->firstBindings[id] = binding.next;
+        if (0 != binding.next) {
+            this->bindings[binding.next - 1].previous = binding.previous;
+        } else {
+            uint64_t hash = (0 != binding.previous) ? this->bindings[binding.previous - 1].optionHash : 0;
+            this->fingerprint += hash - this->hashes[id];
+            this->hashes[id] = hash;
+            this->lastBindings[id] = binding.previous;
+        }
+        if (0 == this->firstBindings[id]) this->seen[id / 64] &= ~(uint64_t(1) << (id % 64));
+        this->gapEnd++;
+    }
+
+    /**
+     * @brief Records a value bound to an option, and updates the fingerprints.
+     *
+     * @param valueHash The hash of the canonical form of the effective value, see SmartOptionsCanonical; for a
+     * repeatable option, of the value all its values so far accumulate into. NULL to hash the value as it is
+     * spelled, chained with the earlier values of a repeatable option.
+     */
+    void bind(unsigned id, SMARTOPTIONS_SOURCE source, const char *value, int index, int tokenCount, const SmartOptionsEntry &entry,
+              const uint64_t *valueHash = NULL) {
+        SmartOptionsBinding binding = { id, source, value, 0, 0, index, tokenCount, 0, 0 };
+        if (NULL != valueHash) {
+            binding.valueHash = *valueHash;
+        } else {
+            binding.valueHash = (NULL != value) ? SmartOptionsHashString(value, strlen(value)) : 0;
+            size_t previous = this->lastBefore(id);
+            if (entry.isRepeatable && 0 != previous) {
+                binding.valueHash = SmartOptionsHashFinalize(this->bindings[previous - 1].valueHash ^ SmartOptionsHashFinalize(binding.valueHash));
+            }
+        }
+        this->insert(binding, entry);
+    }
+
+    /** @endcond */
+
+private:
+    /**
+     * @brief Inserts a binding, whose value hash is known, in front of the unused slots, and updates the fingerprints.
+     */
+    void insert(const SmartOptionsBinding &binding, const SmartOptionsEntry &entry) {
+        unsigned id = binding.id;
+        uint64_t hash = SmartOptionsHashFinalize(entry.key ^ SmartOptionsHashFinalize(binding.valueHash));
+        if (this->gapStart == this->gapEnd) this->growGap();
+
+        size_t slot = this->gapStart++;
+        size_t previous = this->lastBefore(id);
+        size_t next = (0 != previous) ? this->bindings[previous - 1].next : this->firstBindings[id];
+        this->bindings[slot] = binding;
+        this->bindings[slot].previous = previous;
+        this->bindings[slot].next = next;
+        this->bindings[slot].optionHash = hash;
+        if (0 != previous) this->bindings[previous - 1].next = slot + 1;
+        else this->firstBindings[id] = slot + 1;
+        if (0 != next) {
+            this->bindings[next - 1].previous = slot + 1;   // A later value, after the inserted ones, stays the effective one...
+        } else {
+            this->lastBindings[id] = slot + 1;
+            this->fingerprint += hash - this->hashes[id];
+            this->hashes[id] = hash;
+        }
+        this->seen[id / 64] |= (uint64_t(1) << (id % 64));
+    }
+
+    /**
+     * @brief Retrieves the storage index + 1 of the last binding of an option in front of the unused slots, 0 if none.
+     * The bindings of the option after the slots are walked back, they come later on the command line.
+     */
+    size_t lastBefore(unsigned id) const {
+        size_t previous = this->lastBindings[id];
+        while (0 != previous && previous - 1 >= this->gapEnd) previous = this->bindings[previous - 1].previous;
+        return previous;
+    }
+
+    /**
+     * @brief Makes room for more bindings in front of the following ones. At the end the storage simply grows,
+     * otherwise the following bindings are moved by half the number of bindings, and the links to them are updated.
+     */
+    void growGap() {
+        if (this->gapEnd == this->bindings.size()) {
+            this->bindings.emplace_back();
+            this->gapEnd = this->bindings.size();
+            return;
+        }
+        size_t count = std::max<size_t>(16, this->bindings.size() / 2);
+        this->bindings.insert(this->bindings.begin() + this->gapEnd, count, SmartOptionsBinding());
+        auto shift = [&](size_t &link) {
+            if (link > this->gapEnd) link += count;
+        };
+        for (size_t slot = 0; slot < this->bindings.size(); slot++) {
+            if (slot >= this->gapStart && slot < this->gapEnd + count) continue;
+            shift(this->bindings[slot].next);
+            shift(this->bindings[slot].previous);
+        }
+        for (size_t id = 0; id < this->lastBindings.size(); id++) {
+            shift(this->firstBindings[id]);
+            shift(this->lastBindings[id]);
+        }
+        this->gapEnd += count;
+    }
+
+    /**
+     * @brief Moves a binding across the unused slots, and updates the links to it.
+     *
+     * @param delta Added to its parameter index, which is shifted lazily after the slots, see ParameterIndex().
+     */
+    void moveSlot(size_t from, size_t to, int delta) {
+        if (from != to) {
+            this->bindings[to] = this->bindings[from];
+            const SmartOptionsBinding &binding = this->bindings[to];
+            if (0 != binding.previous) this->bindings[binding.previous - 1].next = to + 1;
+            else this->firstBindings[binding.id] = to + 1;
+            if (0 != binding.next) this->bindings[binding.next - 1].previous = to + 1;
+            else this->lastBindings[binding.id] = to + 1;
+        }
+        this->bindings[to].index += delta;
+    }
+
+    /**
+     * @brief Converts a position in command line order into a storage index.
+     */
+    size_t slotOf(size_t position) const {
+        return (position < this->gapStart) ? position : position + (this->gapEnd - this->gapStart);
+    }
+
+    /**
+     * @brief Converts a storage index into a position in command line order.
+     */
+    size_t positionOf(size_t slot) const {
+        return (slot < this->gapStart) ? slot : slot - (this->gapEnd - this->gapStart);
+    }
+
+    /**
+     * @brief Converts a link (storage index + 1) into a position in command line order + 1, 0 stays 0.
+     */
+    size_t linkPosition(size_t link) const {
+        return (0 != link) ? this->positionOf(link - 1) + 1 : 0;
+    }
+
+    std::pmr::vector<uint64_t> seen;                //!< @brief One bit per option ID, set if the option has been passed.
+    std::pmr::vector<size_t> firstBindings;         //!< @brief Per option ID, the storage index + 1 of its first binding, 0 if none.
+    std::pmr::vector<size_t> lastBindings;          //!< @brief Per option ID, the storage index + 1 of its last binding, 0 if none.
+    std::pmr::vector<uint64_t> hashes;              //!< @brief Per option ID, the fingerprint of its effective value, 0 if none.
+    std::pmr::vector<SmartOptionsBinding> bindings; //!< @brief All the values bound, in command line order, around the unused slots.
+    size_t gapStart = 0;                        //!< @brief The storage index of the first unused slot.
+    size_t gapEnd = 0;                          //!< @brief The storage index after the last unused slot.
+    int tailDelta = 0;                          //!< @brief Added to the parameter index of the bindings after the unused slots.
+    uint64_t fingerprint = 0;                   //!< @brief The sum of the fingerprints of all the options.
+};
+
+/**
+ * @brief A read only view of a result encoded with SmartOptionsResult::Encode(), used in place.
+ *
+ * @details Attaching only checks the header and the sizes, the values are bounds checked when they are
+ * retrieved, so a damaged buffer never leads to reads outside of it. The buffer must outlive the view.
+ */
+class SmartOptionsResultView {
+public:
+    SmartOptionsResultView() : data(NULL), optionCount(0), bindingCount(0), blobSize(0) {}
+
+    /**
+     * @brief Attaches the view to an encoded result.
+     *
+     * @param buffer The encoded result.
+     * @param size The number of bytes available in the buffer.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the buffer holds an encoded result.
+     * @retval SMARTOPTIONS_INVALID_FORMAT if it does not, the view is left empty.
+     */
+    SMARTOPTIONS_STATUS Attach(const void *buffer, size_t size) {
+        *this = SmartOptionsResultView();
+        const char *in = (const char *)buffer;
+        if (NULL == in || size < SmartOptionsEncoding::HEADER_SIZE
+                || SmartOptionsEncoding::MAGIC != SmartOptionsEncoding::load32(in)
+                || SmartOptionsEncoding::VERSION != SmartOptionsEncoding::load32(in + 4)) {
+            return SMARTOPTIONS_INVALID_FORMAT;
+        }
+        uint64_t options = SmartOptionsEncoding::load32(in + 8);
+        uint64_t bindings = SmartOptionsEncoding::load32(in + 12);
+        uint64_t blob = SmartOptionsEncoding::load32(in + 16);
+        uint64_t blobOffset = SmartOptionsEncoding::HEADER_SIZE + ((options + 63) / 64) * sizeof(uint64_t)
+                            + options * sizeof(uint32_t) + bindings * SmartOptionsEncoding::BINDING_SIZE;
+        if (blobOffset + blob > size || (0 != blob && '\0' != in[blobOffset + blob - 1])) {
+            return SMARTOPTIONS_INVALID_FORMAT;
+        }
+
+        this->data = in;
+        this->optionCount = (uint32_t)options;
+        this->bindingCount = (uint32_t)bindings;
+        this->blobSize = (uint32_t)blob;
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Retrieves the number of options of the encoded result.
+     */
+    size_t OptionCount() const {
+        return this->optionCount;
+    }
+
+    /**
+     * @brief Retrieves the number of values bound in the encoded result.
+     */
+    size_t BindingCount() const {
+        return this->bindingCount;
+    }
+
+    /**
+     * @brief Checks whether an option has been passed, see SmartOptionsResult::IsSet().
+     */
+    bool IsSet(unsigned id) const {
+        if (id >= this->optionCount) return false;
+        uint64_t word = SmartOptionsEncoding::load64(this->data + SmartOptionsEncoding::HEADER_SIZE + (id / 64) * sizeof(uint64_t));
+        return 0 != ((word >> (id % 64)) & 1);
+    }
+
+    /**
+     * @brief Retrieves where the value of an option comes from, see SmartOptionsResult::Source().
+     */
+    SMARTOPTIONS_SOURCE Source(unsigned id) const {
+        size_t index = this->lastBinding(id);
+        return (index < this->bindingCount) ? this->BindingSource(index) : SMARTOPTIONS_SOURCE_DEFAULT;
+    }
+
+    /**
+     * @brief Retrieves the last value passed for an option, see SmartOptionsResult::Value().
+     */
+    const char *Value(unsigned id) const {
+        size_t index = this->lastBinding(id);
+        return (index < this->bindingCount) ? this->BindingValue(index) : NULL;
+    }
+
+    /**
+     * @brief Retrieves the option ID of a binding.
+     *
+     * @param index The index of the binding, in command line order, less than BindingCount().
+     */
+    unsigned BindingId(size_t index) const {
+        return SmartOptionsEncoding::load32(this->binding(index));
+    }
+
+    /**
+     * @brief Retrieves where the value of a binding comes from.
+     *
+     * @param index The index of the binding, in command line order, less than BindingCount().
+     */
+    SMARTOPTIONS_SOURCE BindingSource(size_t index) const {
+        return (SMARTOPTIONS_SOURCE)SmartOptionsEncoding::load32(this->binding(index) + 4);
+    }
+
+    /**
+     * @brief Retrieves the value of a binding.
+     *
+     * @param index The index of the binding, in command line order, less than BindingCount().
+     *
+     * @returns The value string, or NULL for flags and damaged values.
+     */
+    const char *BindingValue(size_t index) const {
+        const char *binding = this->binding(index);
+        uint32_t offset = SmartOptionsEncoding::load32(binding + 8);
+        uint32_t length = SmartOptionsEncoding::load32(binding + 12);
+        if (offset >= this->blobSize || length >= this->blobSize - offset) return NULL;
+
+        const char *value = this->blob() + offset;
+        return ('\0' == value[length]) ? value : NULL;
+    }
+
+private:
+    const char *binding(size_t index) const {
+        return this->data + SmartOptionsEncoding::HEADER_SIZE + ((this->optionCount + 63) / 64) * sizeof(uint64_t)
+             + this->optionCount * sizeof(uint32_t) + index * SmartOptionsEncoding::BINDING_SIZE;
+    }
+
+    const char *blob() const {
+        return this->binding(this->bindingCount);
+    }
+
+    /**
+     * @brief Retrieves the index of the last binding of an option, BindingCount() or more if there is none.
+     */
+    size_t lastBinding(unsigned id) const {
+        if (false == this->IsSet(id)) return this->bindingCount;
+        const char *last = this->data + SmartOptionsEncoding::HEADER_SIZE + ((this->optionCount + 63) / 64) * sizeof(uint64_t) + id * sizeof(uint32_t);
+        return (size_t)SmartOptionsEncoding::load32(last) - 1;
+    }
+
+    const char *data;       //!< @brief The encoded result.
+    uint32_t optionCount;   //!< @brief The number of options.
+    uint32_t bindingCount;  //!< @brief The number of bindings.
+    uint32_t blobSize;      //!< @brief The size of the string blob.
+};
+
+/**
+ * @brief A command line built by SmartOptions::BuildArgv(), the pointer array and all the strings are held in a
+ * single allocation, ready to be passed to execve().
+ */
+class SmartOptionsArgv {
+public:
+    SmartOptionsArgv() : memory(NULL), count(0) {}
+
+    ~SmartOptionsArgv() {
+        free(this->memory);
+    }
+
+    SmartOptionsArgv(const SmartOptionsArgv &) = delete;
+    SmartOptionsArgv &operator=(const SmartOptionsArgv &) = delete;
+
+    /**
+     * @brief Retrieves the number of command line parameters, including the program name.
+     */
+    int Argc() const {
+        return (int)this->count;
+    }
+
+    /**
+     * @brief Retrieves the command line parameters, terminated by a NULL pointer, or NULL if none has been built.
+     */
+    char *const *Argv() const {
+        return this->memory;
+    }
+
+    /** @cond INTERNAL */
+
+    /**
+     * @brief Takes over a malloc()ed command line.
+     */
+    void assign(char **memory, size_t count) {
+        free(this->memory);
+        this->memory = memory;
+        this->count = count;
+    }
+
+    /** @endcond */
+
+private:
+    char **memory;  //!< @brief The pointer array, followed by the strings.
+    size_t count;   //!< @brief The number of command line parameters.
+};
+
+/**
+ * @brief An ordered list of sources of command line parameters, processed as one sequence, see
+ * SmartOptions::ProcessCommandArgs().
+ *
+ * @details Like with argv, the parameter 0 is the program name. The parameters of the sources follow in the
+ * order in which the sources are added, for example the default parameters from an environment variable, then
+ * those of a response file, then the actual command line. The arrays of the sources are only referenced; the
+ * strings of environment variables are copied once and response files are read once, and both are split in place.
+ */
+class SmartOptionsTokenChain {
+public:
+    /**
+     * @brief The Constructor.
+     *
+     * @param programName The name of the program, the parameter 0.
+     */
+    explicit SmartOptionsTokenChain(const char *programName)
+    : programName(programName)
+    {
+        this->ends.push_back(1);
+        this->segments.push_back(Segment(&this->programName, SMARTOPTIONS_SOURCE_COMMAND_LINE));
+    }
+
+    SmartOptionsTokenChain(const SmartOptionsTokenChain &) = delete;
+    SmartOptionsTokenChain &operator=(const SmartOptionsTokenChain &) = delete;
+
+    /**
+     * @brief Adds parameters, which are referenced and must outlive the processing.
+     *
+     * @param count The number of parameters.
+     * @param tokens The parameters, for example argv + 1.
+     * @param source Where the parameters come from.
+     */
+    void AddTokens(int count, const char **tokens, SMARTOPTIONS_SOURCE source) {
+        if (count <= 0) return;
+        this->ends.push_back(this->ends.back() + count);
+        this->segments.push_back(Segment(tokens, source));
+    }
+
+    /**
+     * @brief Adds the parameters of a string, separated by white space, see AddEnvironment().
+     *
+     * @param text The string, which is copied.
+     * @param source Where the parameters come from.
+     */
+    void AddString(const char *text, SMARTOPTIONS_SOURCE source) {
+        Segment segment(NULL, source);
+        size_t length = strlen(text);
+        segment.text.reset(new char[length + 1]);
+        memcpy(segment.text.get(), text, length + 1);
+        this->addSegment(segment);
+    }
+
+    /**
+     * @brief Adds the parameters of an environment variable, like JAVA_TOOL_OPTIONS.
+     *
+     * @details The parameters are separated by white space, and may be quoted with ' or " to contain white
+     * space. Nothing is added if the variable is not set.
+     *
+     * @param name The name of the environment variable.
+     */
+    void AddEnvironment(const char *name) {
+        const char *text = getenv(name);
+        if (NULL != text) this->AddString(text, SMARTOPTIONS_SOURCE_ENVIRONMENT);
+    }
+
+    /**
+     * @brief Adds the parameters of a response file, split like those of AddEnvironment(); new lines are white space.
+     *
+     * @param path The path of the file.
+     *
+     * @returns SMARTOPTIONS_SUCCESS, or SMARTOPTIONS_SYSTEM_ERROR if the file could not be read, check errno.
+     */
+    SMARTOPTIONS_STATUS AddResponseFile(const char *path) {
+        std::unique_ptr<FILE, int (*)(FILE *)> file(fopen(path, "rb"), &fclose);
+        if (NULL == file) return SMARTOPTIONS_SYSTEM_ERROR;
+
+        // The file is read straight into the string of the source, sized by the file when it can be seeked; one
+        // byte is left for the '\0' and one to reach the end without growing. Pipes grow the string as they go...
+        size_t capacity = 4096;
+        if (0 == fseek(file.get(), 0, SEEK_END)) {
+            long end = ftell(file.get());
+            if (end >= 0) capacity = (size_t)end + 2;
+            if (0 != fseek(file.get(), 0, SEEK_SET)) return SMARTOPTIONS_SYSTEM_ERROR;
+        }
+        Segment segment(NULL, SMARTOPTIONS_SOURCE_RESPONSE_FILE);
+        segment.text.reset(new char[capacity]);
+        size_t size = 0;
+        while (capacity - 1 == (size += fread(segment.text.get() + size, 1, capacity - 1 - size, file.get()))) {
+            std::shared_ptr<char[]> larger(new char[2 * capacity]);
+            memcpy(larger.get(), segment.text.get(), size);
+            segment.text = larger;
+            capacity *= 2;
+        }
+        if (0 != ferror(file.get())) return SMARTOPTIONS_SYSTEM_ERROR;
+
+        segment.text[size] = '\0';
+        this->addSegment(segment);
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Retrieves the number of parameters, including the program name.
+     */
+    int Count() const {
+        return this->ends.back();
+    }
+
+    /**
+     * @brief Retrieves a parameter.
+     *
+     * @param index The index of the parameter, less than Count().
+     */
+    const char *operator[](int index) const {
+        size_t segment = this->find(index);
+        return this->segments[segment].tokens[index - ((0 == segment) ? 0 : this->ends[segment - 1])];
+    }
+
+    /**
+     * @brief Retrieves where a parameter comes from.
+     *
+     * @param index The index of the parameter, less than Count().
+     */
+    SMARTOPTIONS_SOURCE Source(int index) const {
+        return this->segments[this->find(index)].source;
+    }
+
+private:
+    /** @cond INTERNAL */
+    struct Segment {
+        Segment(const char **tokens, SMARTOPTIONS_SOURCE source) : tokens(tokens), source(source) {}
+
+        const char **tokens;                //!< @brief The parameters of the source.
+        SMARTOPTIONS_SOURCE source;         //!< @brief Where the parameters come from.
+        std::shared_ptr<char[]> text;           //!< @brief The copied string, split in place, if any.
+        std::shared_ptr<const char *[]> split;  //!< @brief The parameters split from the copied string, if any.
+    };
+    /** @endcond */
+
+    /**
+     * @brief Finds the source of a parameter.
+     */
+    size_t find(int index) const {
+        return std::upper_bound(this->ends.begin(), this->ends.end(), index) - this->ends.begin();
+    }
+
+    /**
+     * @brief Splits the copied string of a source in place, and adds its parameters.
+     *
+     * @param segment The source, holding the copied string.
+     */
+    void addSegment(Segment &segment) {
+        std::vector<const char *> tokens;
+        char *read = segment.text.get();
+        char *write = read;
+        while (true) {
+            while ('\0' != *read && isspace((unsigned char)*read)) read++;
+            if ('\0' == *read) break;
+
+            // Copy the parameter over itself, dropping the quotes...
+            tokens.push_back(write);
+            char quote = 0;
+            for (; '\0' != *read && (0 != quote || !isspace((unsigned char)*read)); read++) {
+                if (0 == quote && ('"' == *read || '\'' == *read)) quote = *read;
+                else if (0 != quote && quote == *read) quote = 0;
+                else *write++ = *read;
+            }
+            if ('\0' != *read) read++;
+            *write++ = '\0';
+        }
+        if (tokens.empty()) return;
+
+        segment.split.reset(new const char *[tokens.size()]);
+        std::copy(tokens.begin(), tokens.end(), segment.split.get());
+        segment.tokens = segment.split.get();
+        this->ends.push_back(this->ends.back() + (int)tokens.size());
+        this->segments.push_back(segment);
+    }
+
+    // Member Variables
+    const char *programName;            //!< @brief The parameter 0.
+    std::vector<int> ends;              //!< @brief Per source, the index following its last parameter.
+    std::vector<Segment> segments;      //!< @brief The sources, in order.
+};
+
+/** @cond INTERNAL */
+
+/**
+ * @brief Renders JSON text. Without a buffer it only counts the characters, so the same code sizes the buffer
+ * exactly and then fills it.
+ */
+struct SmartOptionsJsonWriter {
+    char *buffer;       //!< @brief The buffer being filled, NULL while sizing.
+    size_t length;      //!< @brief The number of characters rendered so far.
+
+    void raw(const char *str, size_t count) {
+        if (NULL != this->buffer) memcpy(this->buffer + this->length, str, count);
+        this->length += count;
+    }
+
+    void raw(const char *str) {
+        this->raw(str, strlen(str));
+    }
+
+    void number(size_t value) {
+        char digits[24];
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        this->raw(digits, result.ptr - digits);
+    }
+
+    /**
+     * @brief Renders a string, quoted and escaped, or null.
+     */
+    void string(const char *str, size_t count) {
+        static const char HEX_DIGITS[] = "0123456789abcdef";
+        if (NULL == str) {
+            this->raw("null", 4);
+            return;
+        }
+        this->raw("\"", 1);
+        size_t start = 0;
+        for (size_t i = 0; i < count; i++) {
+            unsigned char c = (unsigned char)str[i];
+            if (c >= 0x20 && '"' != c && '\\' != c) continue;
+
+            // Copy the run of plain characters, then the escape sequence...
+            this->raw(str + start, i - start);
+            start = i + 1;
+            switch (c) {
+                case '"':  this->raw("\\\"", 2); break;
+                case '\\': this->raw("\\\\", 2); break;
+                case '\b': this->raw("\\b", 2); break;
+                case '\f': this->raw("\\f", 2); break;
+                case '\n': this->raw("\\n", 2); break;
+                case '\r': this->raw("\\r", 2); break;
+                case '\t': this->raw("\\t", 2); break;
+                default: {
+                    char escaped[6] = { '\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0x0F] };
+                    this->raw(escaped, sizeof(escaped));
+                }
+            }
+        }
+        this->raw(str + start, count - start);
+        this->raw("\"", 1);
+    }
+
+    void string(const char *str) {
+        this->string(str, (NULL != str) ? strlen(str) : 0);
+    }
+};
+
+/** @endcond */
+
+#if defined(SMARTOPTIONS_TELEMETRY)
+
+/**
+ * @brief Counts how many times each option is passed in this process, indexed by the option ID, see
+ * SmartOptions::SetTelemetryFile().
+ *
+ * @details There is a single set of counters per process. The SmartOptions which sets the telemetry file, and
+ * every copy of it made afterwards (like the published specs), count into it, so each parse is counted once
+ * whichever copy runs it. The counters are relaxed atomics, so concurrent parses count without locking. They
+ * are appended to the telemetry file once, when the process exits.
+ * @cond INTERNAL
+ */
+class SmartOptionsTelemetry {
+public:
+    /**
+     * @brief Retrieves the counters of the process, registering the flush at exit on first use.
+     */
+    static SmartOptionsTelemetry &Instance() {
+        static SmartOptionsTelemetry telemetry;
+        // Registered once the counters are constructed, so that they are destroyed after the flush...
+        static const bool isRegistered = (0 == atexit(&SmartOptionsTelemetry::flushAtExit));
+        (void)isRegistered;
+        return telemetry;
+    }
+
+    SmartOptionsTelemetry(const SmartOptionsTelemetry &) = delete;
+    SmartOptionsTelemetry &operator=(const SmartOptionsTelemetry &) = delete;
+
+    /**
+     * @brief Sets the program and the file the counters are appended to, and resets the counters and the names.
+     *
+     * @param appName The program name, written at the start of the line.
+     * @param path The path of the file, NULL disables the flush at exit.
+     */
+    void SetFile(const char *appName, const char *path) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->appName = (NULL != appName) ? appName : "";
+        this->file = (NULL != path) ? path : "";
+        this->names.clear();
+        for (size_t id = 0; id < this->size; id++) this->counts[id].store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sets the name an option is written with, adding counters up to its option ID. Not thread safe with
+     * parses, call it while adding options.
+     *
+     * @param id The option ID.
+     * @param name The name of the option.
+     */
+    void SetName(unsigned id, const char *name) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (id >= this->names.size()) this->names.resize(id + 1);
+        this->names[id] = name;
+        this->resize(this->names.size());
+    }
+
+    /**
+     * @brief Counts a hit of an option.
+     *
+     * @param id The option ID.
+     */
+    void Hit(unsigned id) {
+        if (id < this->size) this->counts[id].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Retrieves the hits of an option, since the last flush.
+     *
+     * @param id The option ID.
+     */
+    uint64_t Get(unsigned id) const {
+        return (id < this->size) ? this->counts[id].load(std::memory_order_relaxed) : 0;
+    }
+
+    /**
+     * @brief Appends the hits of all the options to the telemetry file, and resets them, see
+     * SmartOptions::FlushTelemetry().
+     */
+    SMARTOPTIONS_STATUS Flush() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        std::string line = this->appName;
+        for (size_t id = 0; id < this->names.size(); id++) {
+            line += ' ';
+            line += this->names[id];
+            line += '=';
+            line += std::to_string(this->counts[id].exchange(0, std::memory_order_relaxed));
+        }
+        line += '\n';
+
+        // A single write, so that the lines of processes sharing the file do not interleave...
+        FILE *file = (false == this->file.empty()) ? fopen(this->file.c_str(), "a") : NULL;
+        if (NULL == file) return SMARTOPTIONS_SYSTEM_ERROR;
+        setvbuf(file, NULL, _IONBF, 0);
+        bool isWritten = (line.size() == fwrite(line.data(), 1, line.size(), file));
+        if (0 != fclose(file)) isWritten = false;
+        return isWritten ? SMARTOPTIONS_SUCCESS : SMARTOPTIONS_SYSTEM_ERROR;
+    }
+
+    /**
+     * @brief Retrieves the number of bytes allocated by the counters and the names.
+     */
+    size_t MemoryFootprint() const {
+        return this->capacity * sizeof(std::atomic<uint64_t>) + this->names.capacity() * sizeof(std::string);
+    }
+
+private:
+    SmartOptionsTelemetry()
+    : size(0),
+      capacity(0)
+    {
+    }
+
+    /**
+     * @brief Appends the hits to the telemetry file at exit, if one is set.
+     */
+    static void flushAtExit() {
+        SmartOptionsTelemetry &telemetry = SmartOptionsTelemetry::Instance();
+        if (false == telemetry.file.empty()) telemetry.Flush();
+    }
+
+    /**
+     * @brief Adds counters, set to zero, up to a number of options.
+     */
+    void resize(size_t size) {
+        if (size > this->capacity) {
+            size_t capacity = (this->capacity < 16) ? 16 : this->capacity;
+            while (capacity < size) capacity *= 2;
+
+            std::unique_ptr<std::atomic<uint64_t>[]> counts(new std::atomic<uint64_t>[capacity]);
+            for (size_t id = 0; id < capacity; id++) {
+                counts[id].store((id < this->size) ? this->counts[id].load(std::memory_order_relaxed) : 0, std::memory_order_relaxed);
+            }
+            this->counts.swap(counts);
+            this->capacity = capacity;
+        }
+        if (size > this->size) this->size = size;
+    }
+
+    // Member Variables
+    std::mutex mutex;                                   //!< @brief Guards the names, the file and the flush.
+    std::string appName;                                //!< @brief The program name.
+    std::string file;                                   //!< @brief The telemetry file, empty if none.
+    std::vector<std::string> names;                     //!< @brief The names of the options, indexed by the option ID.
+    std::unique_ptr<std::atomic<uint64_t>[]> counts;    //!< @brief The counters, indexed by the option ID.
+    size_t size;            //!< @brief The number of options counted.
+    size_t capacity;        //!< @brief The number of counters allocated.
+};
+
+/** @endcond */
+
+#endif
+
+/**
+ * @brief SmartOptions, the next generation of Command Line Parameter processing library.
+ * @details SmartOptions is used for processing command line parameters. It has been inspired by
+ * the command line processing in Python.
+ */
+class SmartOptions {
+public: // Public Member Functions...
+    /**
+     * @brief The Constructor
+     * @param programName The name of the program to be used while printing auto help...
+     * @param autoPrintHelp Prints the help message automatically by using the available data.
+     */
+    SmartOptions(const char *programName, bool autoPrintHelp)
+    : SmartOptions(programName, autoPrintHelp, std::pmr::get_default_resource())
+    {
+    }
+
+    /**
+     * @brief The Constructor, with a memory resource for all the options, the current result and the arena.
+     *
+     * @details When the resource is exhausted, the option being added is dropped, and the next processing
+     * returns SMARTOPTIONS_SYSTEM_ERROR, with errno set to ENOMEM. The resource must outlive this object.
+     *
+     * @param programName The name of the program to be used while printing auto help...
+     * @param autoPrintHelp Prints the help message automatically by using the available data.
+     * @param resource The memory resource, for example a std::pmr::monotonic_buffer_resource.
+     */
+    SmartOptions(const char *programName, bool autoPrintHelp, std::pmr::memory_resource *resource)
+    : options(resource),
+      flags(resource),
+      posArgs(resource),
+      values(resource),
+      pathChecks(resource),
+      entries(resource),
+      helpTexts(resource),
+      plugins(resource),
+      targets(resource),
+      result(resource)
+    {
+        this->argC = 0;
+        this->argV = NULL;
+
+        this->appName = programName;
+        this->usage = NULL;
+        this->description = NULL;
+        this->autoPrintHelp = autoPrintHelp;
+        this->arena = std::make_shared<SmartOptionsArena>(resource);
+        this->resultStatus = SMARTOPTIONS_INVALID_ARGUMENT;
+        this->addStatus = SMARTOPTIONS_SUCCESS;
+#if defined(SMARTOPTIONS_TELEMETRY)
+        this->telemetry = NULL;
+#endif
+    }
+
+#if defined(SMARTOPTIONS_TELEMETRY)
+    /**
+     * @brief Counts the hits of the options of this object, and of the copies made from now on, and sets the
+     * file they are appended to when the process exits, see FlushTelemetry().
+     *
+     * @details The counters belong to the process and are indexed by the option ID, so a single SmartOptions (the
+     * spec the others are copied from) should set the file, once its options are added. The counters are reset.
+     *
+     * @param path The path of the file, created if needed. NULL stops counting and disables the flush at exit.
+     */
+    void SetTelemetryFile(const char *path) {
+        this->telemetry = (NULL != path) ? &SmartOptionsTelemetry::Instance() : NULL;
+        SmartOptionsTelemetry::Instance().SetFile(this->appName, path);
+        for (size_t id = 0; NULL != this->telemetry && id < this->entries.size(); id++) {
+            this->telemetry->SetName((unsigned)id, this->telemetryName(this->entries[id].prefixShort, this->entries[id].prefixLong,
+                                                                      this->helpTexts[id].metaVariable).c_str());
+        }
+    }
+
+    /**
+     * @brief Retrieves the number of times an option has been passed in this process, since the last
+     * FlushTelemetry(), 0 if the hits are not counted.
+     *
+     * @details Only ProcessCommandArgs() counts; Parse() and ProcessCommandArgsEdit() do not, so that checking or
+     * editing a command line does not count its options again.
+     *
+     * @param id The option ID, less than OptionCount().
+     */
+    uint64_t HitCount(unsigned id) const {
+        return (NULL != this->telemetry) ? this->telemetry->Get(id) : 0;
+    }
+
+    /**
+     * @brief Appends the hits of all the options to the telemetry file, and resets them. This is done once at
+     * exit, call it to flush earlier.
+     *
+     * @details A single line is appended: the program name, followed by a name=hits pair for every option, in the
+     * order of the option IDs. The name is the long prefix, else the short prefix, else the meta variable of a
+     * positional argument. Options never passed are written with 0 hits, so unused options show up.
+     *
+     * @returns SMARTOPTIONS_SUCCESS, or SMARTOPTIONS_SYSTEM_ERROR if the file could not be written, check errno.
+     */
+    SMARTOPTIONS_STATUS FlushTelemetry() const {
+        return SmartOptionsTelemetry::Instance().Flush();
+    }
+#endif
+
+    /**
+     * @brief Sets the description string for the current program.
+     *
+     * @param description The description string for the current program.
+     */
+    void AddDescription(const char *description) {
+        this->description = description;
+    }
+
+    /**
+     * @brief Sets the usage string for the current program.
+     *
+     * @param usage The usage string for the current program.
+     */
+    void AddUsage(const char *usage ) {
+        this->usage = usage;
+    }
+
+    /**
+     * @brief Adds a command line options to the processing engine.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the retrieved value is stored into.
+     */
+    void AddOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString, const char **destVariable) {
+        SmartOptionsOptionArg option(prefixShort, prefixLong, destVariable);
+        this->addArg(this->options, option, metaVariable, helpString, SMARTOPTIONS_ARG_OPTION);
+    }
+
+    /**
+     * @brief Adds a command line option, whose value is converted to a double.
+     *
+     * @details The value is converted with std::from_chars(), which is locale independent and correctly rounded.
+     * The destination variable keeps its current value when the option is not passed.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the converted value is stored into.
+     */
+    void AddOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString, double *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertFloatingPoint<double>, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option, whose value is converted to a float.
+     *
+     * @details See AddOption() for double.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the converted value is stored into.
+     */
+    void AddOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString, float *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertFloatingPoint<float>, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option, whose value is an ISO-8601 / RFC 3339 timestamp (2024-03-01T12:30:00.5Z).
+     *
+     * @details See SmartOptionsParseTimestamp() for the accepted forms. The destination variable keeps its current
+     * value when the option is not passed.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the converted value is stored into.
+     */
+    void AddOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString, SmartOptionsTimestamp *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertTimestamp, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option whose value is read from a file, only when it is accessed.
+     *
+     * @details With isInlineAllowed false the value is always a path (--token-file PATH). With isInlineAllowed
+     * true the value is used as is, unless it starts with '@', in which case the rest names the file (--query=@PATH).
+     * The file is not opened while processing the command line, see SmartOptionsFileValue::View().
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the file (or inline value) is bound into.
+     * @param isInlineAllowed true to accept inline values and '@' prefixed paths.
+     */
+    void AddFileOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                       SmartOptionsFileValue *destVariable, bool isInlineAllowed) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   isInlineAllowed ? &SmartOptions::convertFileOrInline : &SmartOptions::convertFile, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option whose value is a path, which is checked once the command line has
+     * been processed.
+     *
+     * @details The checks of all the path options passed are run concurrently on a small pool of threads at the
+     * end of ProcessCommandArgs(), so that the latency of a slow (network) file system is paid once rather than
+     * once per path. All the failed checks are reported together.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param checks A combination of SMARTOPTIONS_PATH_CHECK values.
+     * @param destVariable A pointer, where the path is stored into.
+     */
+    void AddPathOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                       unsigned checks, const char **destVariable) {
+        (*destVariable) = NULL;
+
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertPath, NULL);
+        if (false == this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE)) return;
+
+        SmartOptionsPathCheck pathCheck = { prefixShort, checks, destVariable, this->values.back().id };
+        try {
+            this->pathChecks.push_back(pathCheck);
+        } catch (const std::bad_alloc &) {
+            errno = ENOMEM;
+            this->addStatus = SMARTOPTIONS_SYSTEM_ERROR;
+        }
+    }
+
+    /**
+     * @brief Adds a command line option in whose value environment variables and '~' are expanded, when the
+     * value is first read.
+     *
+     * @details See SmartOptionsExpandedValue for the expansion rules.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the value is bound into.
+     */
+    void AddExpandedOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                           SmartOptionsExpandedValue *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertExpanded, this->arena.get());
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option, whose value is converted to T by SmartOptionsConverter<T>.
+     *
+     * @details The destination variable keeps its current value when the option is not passed, or when the
+     * conversion fails. T must be default constructible, Parse() checks values by converting them into a scratch T.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the converted value is stored into.
+     */
+    template <typename T>
+    void AddOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString, T *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertCustom<T>, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line flag to the processing engine.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the value is retrieved and stored into.
+     */
+    void AddFlag(char prefixShort, const char *prefixLong, const char *helpString, bool *destVariable) {
+        SmartOptionsFlagArg flag(prefixShort, prefixLong, destVariable);
+        this->addArg(this->flags, flag, NULL, helpString, SMARTOPTIONS_ARG_FLAG);
+    }
+
+    /**
+     * @brief Adds a command line option which accepts one of a fixed set of words, and stores the
+     * integral (enum) value of the word.
+     *
+     * @details The destination variable keeps its current value when the option is not passed. A value which
+     * is not one of the choices is rejected, and the list of valid choices is reported.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param choices The words accepted and their values, see SmartOptionsChoices. Must outlive the processing engine.
+     * @param destVariable A pointer, where the value of the word is stored into.
+     */
+    template <typename E, size_t N>
+    void AddEnumOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                       const SmartOptionsChoices<E, N> &choices, E *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertEnum<E, N>, &choices);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option which accepts a comma separated list of feature names, and sets
+     * or clears the bit of each feature in a mask.
+     *
+     * @details A name enables its feature, a name prefixed with '-' disables it (-f a,b,-c). The destination
+     * mask keeps its current value as the default set, and every occurrence of the option is applied to the
+     * mask in order (OR for enabled features, AND-NOT for disabled ones). If a name is unknown, the mask is
+     * left untouched and the list of valid features is reported.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param features The feature names and their bit positions, see SmartOptionsChoices. Must outlive the processing engine.
+     * @param destVariable A pointer to the mask, either a uint64_t or a std::bitset for more than 64 features.
+     */
+    template <typename M, size_t N>
+    void AddFeatureSetOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                             const SmartOptionsChoices<unsigned, N> &features, M *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertFeatureSet<M, N>, &features);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE, true);
+    }
+
+    /**
+     * @brief Adds a command line option which accepts an IPv4 or IPv6 address.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the parsed address is stored into.
+     */
+    void AddAddressOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                          SmartOptionsIPAddress *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertAddress, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option which accepts a host:port endpoint.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the parsed endpoint is stored into.
+     */
+    void AddEndpointOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                           SmartOptionsEndpoint *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertEndpoint, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a command line option which accepts a network prefix in CIDR notation.
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the parsed prefix is stored into.
+     */
+    void AddPrefixOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                         SmartOptionsIPPrefix *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertPrefix, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE);
+    }
+
+    /**
+     * @brief Adds a repeatable command line option which accepts a network prefix in CIDR notation, and
+     * collects every occurrence into a prefix table (for example an allow-list).
+     *
+     * @param prefixShort A single character used to specify the option in POSIX style
+     * @param prefixLong A string used to specify the option in GNU style.
+     * @param metaVariable A string which specifies the meta variable which indicates the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer to the table, which the parsed prefixes are inserted into.
+     */
+    void AddPrefixOption(char prefixShort, const char *prefixLong, const char *metaVariable, const char *helpString,
+                         SmartOptionsIPPrefixTable *destVariable) {
+        SmartOptionsValueArg value(prefixShort, prefixLong, destVariable,
+                                   &SmartOptions::convertPrefixTable, NULL);
+        this->addArg(this->values, value, metaVariable, helpString, SMARTOPTIONS_ARG_VALUE, true);
+    }
+
+    /**
+     * @brief Add a positional parameter to the processing engine.
+     *
+     * @param metaVariable A string which specifies the meta variable which indicates may indicate the acceptable values.
+     * @param helpString A string which explains the option in context.
+     * @param destVariable A pointer, where the value is retrieved and stored into.
+     */
+    void AddPositionalArgument(const char *metaVariable, const char *helpString, const char **destVariable) {
+        SmartOptionsPositionalArg pos(destVariable);
+        this->addArg(this->posArgs, pos, metaVariable, helpString, SMARTOPTIONS_ARG_POSITIONAL);
+    }
+
+    /**
+     * @brief Attaches the option table of a plugin, see SmartOptionsPlugin.
+     *
+     * @details The table is linked as a whole, its options get consecutive option IDs. Nothing is attached if any of
+     * its options collides with an option already added (or with another option of the table), by its short or
+     * its long prefix. The table and the struct of the plugin must outlive this object. The values of the options
+     * of a plugin are converted into its struct by ProcessCommandArgs(); Parse() checks them, without writing it.
+     *
+     * @param table The option table.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the table is attached.
+     * @retval SMARTOPTIONS_INVALID_ARGUMENT if the table is of another version, has positional members, or collides.
+     * @retval SMARTOPTIONS_SYSTEM_ERROR if the memory could not be allocated.
+     */
+    SMARTOPTIONS_STATUS AttachPlugin(const SmartOptionsPluginTable &table) {
+        if (SMARTOPTIONS_PLUGIN_ABI_VERSION != table.abiVersion) return SMARTOPTIONS_INVALID_ARGUMENT;
+
+        // Check for collisions, with the short prefixes in a bit set and the long ones one by one...
+        std::bitset<256> isUsed;
+        for (size_t id = 0; id < this->entries.size(); id++) {
+            if (SMARTOPTIONS_ARG_POSITIONAL != this->entries[id].kind) isUsed.set((unsigned char)this->entries[id].prefixShort);
+        }
+        for (size_t member = 0; member < table.memberCount; member++) {
+            const SmartOptionsMember &option = table.members[member];
+            if (0 == option.prefixShort || isUsed.test((unsigned char)option.prefixShort)) return SMARTOPTIONS_INVALID_ARGUMENT;
+            isUsed.set((unsigned char)option.prefixShort);
+
+            if (NULL == option.prefixLong) continue;
+            if (INVALID_OPTION_ID != this->FindOption(option.prefixLong)) return SMARTOPTIONS_INVALID_ARGUMENT;
+            for (size_t other = 0; other < member; other++) {
+                if (NULL != table.members[other].prefixLong && 0 == strcmp(table.members[other].prefixLong, option.prefixLong)) {
+                    return SMARTOPTIONS_INVALID_ARGUMENT;
+                }
+            }
+        }
+
+        // Link the table...
+        SmartOptionsPluginLink link = { &table, (unsigned)this->entries.size() };
+        try {
+            this->entries.reserve(this->entries.size() + table.memberCount);
+            this->helpTexts.reserve(this->helpTexts.size() + table.memberCount);
+            this->targets.reserve(this->targets.size() + table.memberCount);
+#if defined(SMARTOPTIONS_TELEMETRY)
+            for (size_t member = 0; NULL != this->telemetry && member < table.memberCount; member++) {
+                this->telemetry->SetName((unsigned)(this->entries.size() + member),
+                                         SmartOptions::telemetryName(table.members[member].prefixShort, table.members[member].prefixLong, NULL).c_str());
+            }
+#endif
+            this->plugins.push_back(link);
+        } catch (const std::bad_alloc &) {
+            errno = ENOMEM;
+            return SMARTOPTIONS_SYSTEM_ERROR;
+        }
+        for (size_t member = 0; member < table.memberCount; member++) {
+            const SmartOptionsMember &option = table.members[member];
+            SmartOptionsEntry entry = { option.isFlag ? SMARTOPTIONS_ARG_FLAG : SMARTOPTIONS_ARG_VALUE, option.prefixShort,
+                                        option.prefixLong, false, SmartOptionsHashString(&option.prefixShort, 1) };
+            SmartOptionsHelpText text = { option.metaVariable, option.helpString };
+            this->entries.push_back(entry);
+            this->helpTexts.push_back(text);
+            SmartOptionsTarget target = { (char *)table.storage + option.offset, option.isFlag ? NULL : &SmartOptions::convertMember,
+                                          &option, option.initial() };
+            this->targets.push_back(target);
+        }
+        this->helpIndex.Clear();
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Process the command line parameters and populate the appropriate variables with the
+     * results of the processing automatically.
+     *
+     * @details When a command line has been processed before, the variables of its options are first restored to
+     * the values they had before the first command line was processed, so the outcome does not depend on it.
+     *
+     * @param argc The number of command line parameters that are there in the argv array.
+     * @param argv The string array which contains all the command line parameters passed.
+     *
+     * @returns Based on the processing of the command line parameters, the functions returns the
+     * following codes.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if successful.
+     * @retval SMARTOPTIONS_INVALID_ARGUMENT if the processing engine encounters an invalid argument.
+     * @retval SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS if the processing engine encounters less or
+     * more number of arguments that the normal.
+     * @retval SMARTOPTIONS_SYSTEM_ERROR if the memory could not be allocated, errno is set to ENOMEM.
+     */
+    SMARTOPTIONS_STATUS ProcessCommandArgs(int argc, const char **argv) {
+        this->resultStatus = this->guardAllocation([&]() { return this->processCommandArgs(argc, argv); });
+        return this->resultStatus;
+    }
+
+    /**
+     * @brief Processes a command line into a result only: no variable is updated and nothing is printed.
+     *
+     * @details The options are only read, so any number of threads can process command lines with the same
+     * options at the same time, for example with the options published by SmartOptionsSpecPublisher. The
+     * values of typed options are converted into scratch variables, to check them.
+     *
+     * @param argc The number of command line parameters that are there in the argv array.
+     * @param argv The string array which contains all the command line parameters passed.
+     * @param result Receives the result, whose values point into argv.
+     *
+     * @returns The same codes as ProcessCommandArgs().
+     */
+    SMARTOPTIONS_STATUS Parse(int argc, const char **argv, SmartOptionsResult &result) const {
+        return this->guardAllocation([&]() { return this->parse(argc, argv, result); });
+    }
+
+    /**
+     * @brief Processes the command line parameters of a chain of sources, like ProcessCommandArgs() does for argv.
+     *
+     * @details The sources are read in order, as if their parameters were a single argv array, without building
+     * one; an option and its value may come from different sources. The source of each value is recorded in
+     * the result, see SmartOptionsResult::Source(). The values point into the chain, which must outlive them.
+     *
+     * @param chain The sources of the command line parameters.
+     *
+     * @returns The same codes as ProcessCommandArgs().
+     */
+    SMARTOPTIONS_STATUS ProcessCommandArgs(const SmartOptionsTokenChain &chain) {
+        this->resultStatus = this->guardAllocation([&]() { return this->processCommandArgs(chain.Count(), chain); });
+        return this->resultStatus;
+    }
+
+    /**
+     * @brief Processes the command line parameters of a chain of sources into a result only, see Parse().
+     *
+     * @param chain The sources of the command line parameters.
+     * @param result Receives the result, whose values point into the chain.
+     *
+     * @returns The same codes as ProcessCommandArgs().
+     */
+    SMARTOPTIONS_STATUS Parse(const SmartOptionsTokenChain &chain, SmartOptionsResult &result) const {
+        return this->guardAllocation([&]() { return this->parse(chain.Count(), chain, result); });
+    }
+
+    /**
+     * @brief Processes a command line, which differs from the previously processed one by a single edited
+     * parameter, for example while it is being edited in an interactive console.
+     *
+     * @details Only the parameters from the option touched by the edit up to where the previous bindings line
+     * up again are processed; the remaining bindings are reused without converting or hashing their values
+     * again, and the bindings before the edit are not visited at all. The variables of the affected options are
+     * updated, and the positional argument count and the checks of the affected path options are run again.
+     * An option whose last value is removed gets back the value its variable had before the first command line
+     * was processed, whatever its kind. The whole command line is processed again if the previous one was rejected,
+     * if the edit does not match the argument counts, or if a value of a repeatable option (like a feature set)
+     * is added or removed; the variables of the options passed before are then reset to their defaults first.
+     *
+     * The bindings are stored around a gap of unused slots, which is moved to the edit: the cost is linear in
+     * the number of parameters processed again and in the number of bindings between this edit and the
+     * previous one; the bindings after the edit stay in place, and their parameter indexes are shifted lazily,
+     * see SmartOptionsResult::ParameterIndex(). A new binding walks back over the later bindings of the same
+     * option, and an insertion which fills the gap occasionally moves the bindings after it.
+     *
+     * @param argc The number of command line parameters, after the edit.
+     * @param argv The command line parameters, after the edit. The parameters which are not edited must
+     * remain the same strings as in the previously processed command line.
+     * @param edit How the command line has been edited.
+     * @param index The index of the inserted, replaced or deleted parameter.
+     *
+     * @returns The same codes as ProcessCommandArgs().
+     */
+    SMARTOPTIONS_STATUS ProcessCommandArgsEdit(int argc, const char **argv, SMARTOPTIONS_EDIT edit, int index) {
+        this->resultStatus = this->guardAllocation([&]() { return this->processCommandArgsEdit(argc, argv, edit, index); });
+        return this->resultStatus;
+    }
+
+    /**
+     * @brief Prints the description and help message based on the various flags, options, and positional arguments
+     * that have been added/configured.
+     */
+    void PrintHelp() const {
+        this->printHelp(NULL);
+    }
+
+    /**
+     * @brief Prints the description and the help message of the options matching a keyword, see SearchHelp().
+     *
+     * @details This is meant for a --help=<keyword> option, of tools with a large number of options.
+     *
+     * @param keyword The text to look for.
+     *
+     * @returns The number of options that matched.
+     */
+    size_t PrintHelp(const char *keyword) const {
+        std::vector<unsigned> ids;
+        this->SearchHelp(keyword, ids);
+
+        std::vector<char> isShown(this->entries.size(), 0);
+        for (size_t index = 0; index < ids.size(); index++) isShown[ids[index]] = 1;
+        this->printHelp(&isShown);
+        return ids.size();
+    }
+
+    /**
+     * @brief Builds the index, which speeds up SearchHelp() and PrintHelp() with a keyword.
+     *
+     * @details Call it once all the options have been added, adding an option drops the index. Searches
+     * without an index scan the text of all the options.
+     */
+    void BuildHelpIndex() {
+        this->helpIndex.Build(this->entries, this->helpTexts);
+    }
+
+    /**
+     * @brief Finds the options, whose long prefix, meta variable or help string contain a keyword.
+     *
+     * @details The search ignores case. A single character keyword only matches the option with that short prefix.
+     *
+     * @param keyword The text to look for.
+     * @param ids Receives the IDs of the matching options, sorted.
+     */
+    void SearchHelp(const char *keyword, std::vector<unsigned> &ids) const {
+        ids.clear();
+        size_t length = strlen(keyword);
+        if (length < 3 || this->helpIndex.OptionCount() != this->entries.size()) {
+            for (size_t id = 0; id < this->entries.size(); id++) {
+                if (this->matchesHelp((unsigned)id, keyword)) ids.push_back((unsigned)id);
+            }
+            return;
+        }
+
+        // Only the options having the rarest trigram of the keyword can match...
+        const unsigned *candidates = NULL;
+        size_t candidateCount = 0;
+        for (size_t index = 0; index + 3 <= length; index++) {
+            size_t count = 0;
+            const unsigned *postings = this->helpIndex.Find(keyword + index, count);
+            if (0 == count) return;
+            if (NULL == candidates || count < candidateCount) {
+                candidates = postings;
+                candidateCount = count;
+            }
+        }
+        for (size_t index = 0; index < candidateCount; index++) {
+            if (this->matchesHelp(candidates[index], keyword)) ids.push_back(candidates[index]);
+        }
+    }
+
+    /**
+     * @brief Retrieves the number of options added, the valid option IDs are 0 to OptionCount() - 1.
+     */
+    size_t OptionCount() const {
+        return this->entries.size();
+    }
+
+    /**
+     * @brief Retrieves the ID of an option.
+     *
+     * @param prefixShort The single character used to specify the option.
+     *
+     * @returns The option ID, or INVALID_OPTION_ID if there is no such option.
+     */
+    unsigned FindOption(char prefixShort) const {
+        for (size_t id = 0; id < this->entries.size(); id++) {
+            if (0 != prefixShort && this->entries[id].prefixShort == prefixShort) return (unsigned)id;
+        }
+        return INVALID_OPTION_ID;
+    }
+
+    /**
+     * @brief Retrieves the ID of an option.
+     *
+     * @param prefixLong The string used to specify the option, GNU style.
+     *
+     * @returns The option ID, or INVALID_OPTION_ID if there is no such option.
+     */
+    unsigned FindOption(const char *prefixLong) const {
+        for (size_t id = 0; id < this->entries.size(); id++) {
+            if (NULL != this->entries[id].prefixLong && 0 == strcmp(this->entries[id].prefixLong, prefixLong)) return (unsigned)id;
+        }
+        return INVALID_OPTION_ID;
+    }
+
+    /**
+     * @brief Retrieves the description of an option.
+     *
+     * @param id The option ID, less than OptionCount().
+     */
+    const SmartOptionsEntry &GetEntry(unsigned id) const {
+        return this->entries[id];
+    }
+
+    /**
+     * @brief Retrieves the help text of an option, as shown by PrintHelp().
+     *
+     * @param id The option ID, less than OptionCount().
+     */
+    const SmartOptionsHelpText &GetHelpText(unsigned id) const {
+        return this->helpTexts[id];
+    }
+
+    /**
+     * @brief Retrieves the memory used by the options, their indexes and text, and the current result.
+     */
+    SmartOptionsMemoryFootprint MemoryFootprint() const {
+        SmartOptionsMemoryFootprint footprint = { 0, 0, 0, 0, 0, 0 };
+        footprint.records = sizeof(SmartOptions) +
+                            SmartOptions::listFootprint(this->options) + SmartOptions::listFootprint(this->flags) +
+                            SmartOptions::listFootprint(this->values) + SmartOptions::listFootprint(this->pathChecks) +
+                            this->posArgs.capacity() * sizeof(SmartOptionsPositionalArg) +
+                            this->entries.capacity() * sizeof(SmartOptionsEntry) +
+                            this->plugins.capacity() * sizeof(SmartOptionsPluginLink) +
+                            this->targets.capacity() * sizeof(SmartOptionsTarget);
+        footprint.help = this->helpTexts.capacity() * sizeof(SmartOptionsHelpText);
+        for (size_t id = 0; id < this->entries.size(); id++) {
+            if (NULL != this->entries[id].prefixLong) footprint.names += strlen(this->entries[id].prefixLong) + 1;
+            if (NULL != this->helpTexts[id].metaVariable) footprint.help += strlen(this->helpTexts[id].metaVariable) + 1;
+            if (NULL != this->helpTexts[id].helpString) footprint.help += strlen(this->helpTexts[id].helpString) + 1;
+        }
+        footprint.indexes = this->helpIndex.MemoryFootprint();
+#if defined(SMARTOPTIONS_TELEMETRY)
+        if (NULL != this->telemetry) footprint.indexes += this->telemetry->MemoryFootprint();
+#endif
+        footprint.arena = this->arena->MemoryFootprint();
+        footprint.result = this->result.MemoryFootprint() - sizeof(SmartOptionsResult); // The object is in the records.
+        return footprint;
+    }
+
+    /**
+     * @brief Retrieves the result of the last ProcessCommandArgs() call.
+     */
+    const SmartOptionsResult &GetResult() const {
+        return this->result;
+    }
+
+    /**
+     * @brief Renders the result of the last ProcessCommandArgs() call as JSON, see ToJson(const SmartOptionsResult &).
+     */
+    std::string ToJson() const {
+        return this->ToJson(this->result);
+    }
+
+    /**
+     * @brief Renders a result as JSON, for example to log the effective configuration.
+     *
+     * @details Every option is listed in option ID order, with its names, where its value comes from, and all
+     * the values passed for it:
+     * @code{.json}
+       {"program":"app","options":[{"id":0,"kind":"option","short":"o","long":"output","source":"command-line","values":["a.txt"]},...]}
+       @endcode
+     * Flags have no values, options which have not been passed have the "default" source. The text is sized
+     * exactly first, and then rendered into a single allocation.
+     *
+     * @param result A result of processing a command line with the current options.
+     */
+    std::string ToJson(const SmartOptionsResult &result) const {
+        SmartOptionsJsonWriter writer = { NULL, 0 };
+        this->renderJson(result, writer);
+
+        std::string json(writer.length, NULL_TERMINATE);
+        writer.buffer = &json[0];
+        writer.length = 0;
+        this->renderJson(result, writer);
+        return json;
+    }
+
+    /**
+     * @brief Builds the canonical command line of a result, for example to launch a child process with the same options.
+     *
+     * @details The program name comes first, then the selected options sorted by their short prefix, then the
+     * positional arguments. A flag is emitted once, an option with its last value only, unless every value of
+     * it counts (like feature sets). Values are attached to their option (-ovalue), so values starting with a
+     * '-' keep their meaning; an empty value follows its option as an empty parameter (-o ""), as an attached
+     * empty value could not be told from a missing one.
+     *
+     * @param result A result of processing a command line with the current options.
+     * @param argv Receives the command line.
+     * @param filter Selects the options to be emitted, all of them if NULL.
+     * @param context The context passed along with the filter.
+     * @param isShellQuoted Quotes the parameters for a POSIX shell, where needed, for logging or 'sh -c'. execve()
+     * needs no quoting.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if the command line is built.
+     * @retval SMARTOPTIONS_SYSTEM_ERROR if the memory can not be allocated.
+     */
+    SMARTOPTIONS_STATUS BuildArgv(const SmartOptionsResult &result, SmartOptionsArgv &argv, SmartOptionsFilterFn filter = NULL,
+                                  const void *context = NULL, bool isShellQuoted = false) const {
+        std::vector<unsigned> ids;
+        for (size_t id = 0; id < this->entries.size() && id < result.OptionCount(); id++) {
+            if (false == result.IsSet((unsigned)id)) continue;
+            if (NULL != filter && false == filter((unsigned)id, this->entries[id], context)) continue;
+            ids.push_back((unsigned)id);
+        }
+        std::stable_sort(ids.begin(), ids.end(), [this](unsigned lhs, unsigned rhs) {
+            bool isLhsPositional = (SMARTOPTIONS_ARG_POSITIONAL == this->entries[lhs].kind);
+            bool isRhsPositional = (SMARTOPTIONS_ARG_POSITIONAL == this->entries[rhs].kind);
+            if (isLhsPositional != isRhsPositional) return isRhsPositional;
+            return false == isLhsPositional && (unsigned char)this->entries[lhs].prefixShort < (unsigned char)this->entries[rhs].prefixShort;
+        });
+
+        // The first pass sizes the allocation, the second one fills it...
+        char **slots = NULL;
+        char *strings = NULL;
+        size_t count = 0;
+        size_t bytes = 0;
+        auto emit = [&](char prefixShort, const char *value) {
+            size_t length = writeArgvToken(strings ? strings + bytes : NULL, prefixShort, value, isShellQuoted);
+            if (slots) slots[count] = strings + bytes;
+            count++;
+            bytes += length + 1;
+        };
+        auto emitValue = [&](char prefixShort, const char *value) {
+            emit(prefixShort, value);
+            if (0 != prefixShort && NULL_TERMINATE == value[0]) emit(0, "");
+        };
+        auto walk = [&]() {
+            emit(0, this->appName);
+            for (size_t index = 0; index < ids.size(); index++) {
+                const SmartOptionsEntry &entry = this->entries[ids[index]];
+                char prefixShort = (SMARTOPTIONS_ARG_POSITIONAL == entry.kind) ? 0 : entry.prefixShort;
+                if (SMARTOPTIONS_ARG_FLAG == entry.kind) {
+                    emit(prefixShort, "");
+                } else if (entry.isRepeatable) {
+                    for (const SmartOptionsBinding *binding = result.FirstBinding(ids[index]); NULL != binding; binding = result.NextBinding(binding)) {
+                        emitValue(prefixShort, binding->value);
+                    }
+                } else {
+                    emitValue(prefixShort, result.Value(ids[index]));
+                }
+            }
+        };
+
+        walk();
+        char **memory = (char **)malloc((count + 1) * sizeof(char *) + bytes);
+        if (NULL == memory) return SMARTOPTIONS_SYSTEM_ERROR;
+
+        slots = memory;
+        strings = (char *)(memory + count + 1);
+        count = 0;
+        bytes = 0;
+        walk();
+        slots[count] = NULL;
+        argv.assign(memory, count);
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    static constexpr unsigned INVALID_OPTION_ID = ~0u;   //!< @brief Returned by FindOption(), if there is no such option.
+
+private: // Private Member functions...
+    /**
+     * @brief Implements ProcessCommandArgs(), for an argv array or a SmartOptionsTokenChain.
+     *
+     * @param isCounted Counts the hits of the options, see HitCount().
+     */
+    template <typename Tokens>
+    SMARTOPTIONS_STATUS processCommandArgs(int argc, const Tokens &argv, bool isCounted = true) {
+
+        this->useCommandArgs(argc, argv);
+        this->arena->Reset();
+        this->saveDefaults();
+        this->restorePassed();
+        this->result.reset(this->entries.size());
+
+        size_t posArgsCount = 0;
+        std::string strPosArgErrMsg;
+
+        SMARTOPTIONS_STATUS status = SMARTOPTIONS_SUCCESS;
+        for (int index = 1; index < argc && SMARTOPTIONS_SUCCESS == status; index++) {/* ignore first argv */
+            status = this->processToken(argc, argv, index, posArgsCount, strPosArgErrMsg, this->result, true);
+        }
+        if (isCounted) this->countHits();
+
+        if (SMARTOPTIONS_SUCCESS == status) status = this->validatePositionalCount(posArgsCount, strPosArgErrMsg);
+        if (SMARTOPTIONS_SUCCESS == status) status = this->validatePaths(this->result, NULL, true);
+        this->resultStatus = status;
+        return status;
+    }
+
+    /**
+     * @brief Implements Parse(), for an argv array or a SmartOptionsTokenChain.
+     */
+    template <typename Tokens>
+    SMARTOPTIONS_STATUS parse(int argc, const Tokens &argv, SmartOptionsResult &result) const {
+        result.reset(this->entries.size());
+
+        size_t posArgsCount = 0;
+        std::string strPosArgErrMsg;
+        SmartOptionsScratchList scratches;
+
+        SMARTOPTIONS_STATUS status = SMARTOPTIONS_SUCCESS;
+        for (int index = 1; index < argc && SMARTOPTIONS_SUCCESS == status; index++) {/* ignore first argv */
+            status = this->processToken(argc, argv, index, posArgsCount, strPosArgErrMsg, result, false, &scratches);
+        }
+
+        if (SMARTOPTIONS_SUCCESS == status && posArgsCount != this->posArgs.size()) status = SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS;
+        if (SMARTOPTIONS_SUCCESS == status) status = this->validatePaths(result, NULL, false);
+        return status;
+    }
+
+    /**
+     * @brief Implements ProcessCommandArgsEdit().
+     */
+    SMARTOPTIONS_STATUS processCommandArgsEdit(int argc, const char **argv, SMARTOPTIONS_EDIT edit, int index) {
+        const int delta = (SMARTOPTIONS_EDIT_INSERT == edit) ? 1 : (SMARTOPTIONS_EDIT_DELETE == edit) ? -1 : 0;
+        const int oldArgc = this->argC;
+        if (SMARTOPTIONS_SUCCESS != this->resultStatus || argc - delta != oldArgc
+                || index < 1 || index >= ((SMARTOPTIONS_EDIT_INSERT == edit) ? argc : oldArgc)) {
+            return this->processCommandArgs(argc, argv, false);
+        }
+
+        // Find the first binding touched by the edit, the bindings before it are kept as they are...
+        size_t first = 0;
+        for (size_t last = this->result.BindingCount(); first < last; ) {
+            size_t middle = first + (last - first) / 2;
+            const SmartOptionsBinding &binding = this->result.Binding(middle);
+            if (this->result.ParameterIndex(&binding) + binding.tokenCount <= index) first = middle + 1;
+            else last = middle;
+        }
+        size_t posArgsCount = 0;
+        for (size_t posIndex = 0; posIndex < this->posArgs.size(); posIndex++) {
+            const SmartOptionsBinding *binding = this->result.FirstBinding(this->posArgs[posIndex].id);
+            if (NULL != binding && this->result.position(binding) < first) posArgsCount++;
+        }
+        int position = (first < this->result.BindingCount()) ? std::min(index, this->result.ParameterIndex(&this->result.Binding(first))) : index;
+        this->result.moveGap(first);
+        this->useCommandArgs(argc, argv);
+
+        // Process the parameters until an old binding starts at the same (shifted) parameter, with the same
+        // number of positional arguments before it; the old bindings passed are removed, the new ones inserted
+        // in their place...
+        std::vector<unsigned> affected;
+        bool isRepeatableTouched = false;
+        size_t oldPosArgsCount = posArgsCount;
+        const int editEnd = index + ((SMARTOPTIONS_EDIT_DELETE == edit) ? 0 : 1);
+        std::string strPosArgErrMsg;
+        SMARTOPTIONS_STATUS status = SMARTOPTIONS_SUCCESS;
+        for (; SMARTOPTIONS_SUCCESS == status; position++) {
+            if (position >= editEnd) {
+                const SmartOptionsBinding *old = this->result.following();
+                for (; NULL != old && this->result.ParameterIndex(old) < position - delta; old = this->result.following()) {
+                    const SmartOptionsEntry &entry = this->entries[old->id];
+                    affected.push_back(old->id);
+                    isRepeatableTouched = isRepeatableTouched || entry.isRepeatable;
+                    if (SMARTOPTIONS_ARG_POSITIONAL == entry.kind) oldPosArgsCount++;
+                    this->result.removeFollowing();
+                }
+                bool isAligned = (NULL != old) ? (this->result.ParameterIndex(old) == position - delta) : (position - delta >= oldArgc);
+                if ((isAligned && oldPosArgsCount == posArgsCount) || position >= argc) break;
+            }
+            status = this->processToken(argc, argv, position, posArgsCount, strPosArgErrMsg, this->result, true);
+        }
+        this->result.shiftFollowing(delta);
+
+        // The hashes of the later values of a repeatable option depend on the earlier ones...
+        for (size_t bindingIndex = first; bindingIndex < this->result.insertPosition(); bindingIndex++) {
+            affected.push_back(this->result.Binding(bindingIndex).id);
+            isRepeatableTouched = isRepeatableTouched || this->entries[this->result.Binding(bindingIndex).id].isRepeatable;
+        }
+        if (SMARTOPTIONS_SUCCESS == status && isRepeatableTouched) {
+            // The values of repeatable options accumulate, so the variables of all the options passed before
+            // restart from their defaults; those still in the result are restored by processCommandArgs()...
+            for (size_t affectedIndex = 0; affectedIndex < affected.size(); affectedIndex++) {
+                this->targets[affected[affectedIndex]].initial.Restore(this->targets[affected[affectedIndex]].variable);
+            }
+            return this->processCommandArgs(argc, argv, false);
+        }
+
+        std::sort(affected.begin(), affected.end());
+        affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+        if (SMARTOPTIONS_SUCCESS == status) {
+            // The previous command line had all its positional arguments, those not passed yet follow...
+            posArgsCount += this->posArgs.size() - oldPosArgsCount;
+            this->updateAffected(affected);
+            status = this->validatePositionalCount(posArgsCount, strPosArgErrMsg);
+        }
+        if (SMARTOPTIONS_SUCCESS == status) status = this->validatePaths(this->result, &affected, true);
+        this->resultStatus = status;
+        return status;
+    }
+
+    /**
+     * @brief Sets the internal member variables to use the passed variables, and also extracts and sets the program name...
+     *
+     * @param argC An integer value specifying the number of entries in the argV array.
+     * @param argV A string array containing the list of command line parameters to be processed.
+     */
+    void useCommandArgs(int argC, const char **argV) {
+        this->argC = argC;
+        this->argV = argV;
+    }
+
+    /**
+     * @brief Forgets the command line, when processing a chain of sources: the next edit processes the whole
+     * command line, see ProcessCommandArgsEdit().
+     */
+    void useCommandArgs(int, const SmartOptionsTokenChain &) {
+        this->argC = 0;
+        this->argV = NULL;
+    }
+
+    /**
+     * @brief Retrieves where a command line parameter comes from: the command line, for an argv array.
+     */
+    static SMARTOPTIONS_SOURCE tokenSource(const char **, int) {
+        return SMARTOPTIONS_SOURCE_COMMAND_LINE;
+    }
+
+    /**
+     * @brief Retrieves where a command line parameter comes from, for a chain of sources.
+     */
+    static SMARTOPTIONS_SOURCE tokenSource(const SmartOptionsTokenChain &chain, int index) {
+        return chain.Source(index);
+    }
+
+    /**
+     * @brief Assigns the next option ID to an option, and describes it in the entries.
+     *
+     * @param arg The option, as stored in its list.
+     * @param metaVariable The string which specifies the different option values, NULL for flags.
+     * @param helpString The string which explains the option in context.
+     * @param kind The kind of the option.
+     * @param isRepeatable Every value of the option counts, not only the last one.
+     */
+    void registerArg(SmartOptionsArg &arg, const char *metaVariable, const char *helpString, SMARTOPTIONS_ARG_KIND kind, bool isRepeatable = false) {
+        arg.id = (unsigned)this->entries.size();
+        SmartOptionsEntry entry = { kind, arg.prefixShort, arg.prefixLong, isRepeatable, 0 };
+        SmartOptionsHelpText text = { metaVariable, helpString };
+        this->helpTexts.push_back(text);
+        this->helpIndex.Clear();
+        if (SMARTOPTIONS_ARG_POSITIONAL == kind) {
+            entry.key = SmartOptionsHashString(metaVariable, strlen(metaVariable));
+        } else {
+            entry.key = SmartOptionsHashString(&arg.prefixShort, 1);
+        }
+        this->entries.push_back(entry);
+    }
+
+    /**
+     * @brief Stores an option in its list, and registers it, see registerArg().
+     *
+     * @details The memory needed is allocated first, so that nothing is changed if it can not be; the failure
+     * is then returned by the next processing, as SMARTOPTIONS_SYSTEM_ERROR.
+     *
+     * @param list The list of the options of this kind.
+     * @param arg The option.
+     * @param metaVariable The string which specifies the different option values, NULL for flags.
+     * @param helpString The string which explains the option in context.
+     * @param kind The kind of the option.
+     * @param isRepeatable Every value of the option counts, not only the last one.
+     *
+     * @returns true if the option has been added.
+     */
+    template <typename List>
+    bool addArg(List &list, const typename List::value_type &arg, const char *metaVariable, const char *helpString,
+                SMARTOPTIONS_ARG_KIND kind, bool isRepeatable = false) {
+        try {
+            SmartOptions::reserveNext(this->entries);
+            SmartOptions::reserveNext(this->helpTexts);
+            SmartOptions::reserveNext(this->targets);
+#if defined(SMARTOPTIONS_TELEMETRY)
+            if (NULL != this->telemetry) {
+                this->telemetry->SetName((unsigned)this->entries.size(), SmartOptions::telemetryName(arg.prefixShort, arg.prefixLong, metaVariable).c_str());
+            }
+#endif
+            list.push_back(arg);
+        } catch (const std::bad_alloc &) {
+            errno = ENOMEM;
+            this->addStatus = SMARTOPTIONS_SYSTEM_ERROR;
+            return false;
+        }
+        this->registerArg(list.back(), metaVariable, helpString, kind, isRepeatable);
+        this->targets.push_back(SmartOptions::targetOf(list.back()));
+        return true;
+    }
+
+    /**
+     * @brief Makes room for one more element in a vector, growing it geometrically.
+     */
+    template <typename Vector>
+    static void reserveNext(Vector &vector) {
+        if (vector.size() == vector.capacity()) vector.reserve(std::max<size_t>(16, 2 * vector.capacity()));
+    }
+
+    /**
+     * @brief Describes the variable of an option, see SmartOptionsTarget.
+     */
+    static SmartOptionsTarget targetOf(const SmartOptionsFlagArg &flag) {
+        SmartOptionsTarget target = { flag.destVariable, NULL, NULL, SmartOptionsDefault::For<bool>() };
+        return target;
+    }
+
+    static SmartOptionsTarget targetOf(const SmartOptionsOptionArg &option) {
+        SmartOptionsTarget target = { option.destVariable, NULL, NULL, SmartOptionsDefault::For<const char *>() };
+        return target;
+    }
+
+    static SmartOptionsTarget targetOf(const SmartOptionsPositionalArg &posArg) {
+        SmartOptionsTarget target = { posArg.destVariable, NULL, NULL, SmartOptionsDefault::For<const char *>() };
+        return target;
+    }
+
+    static SmartOptionsTarget targetOf(const SmartOptionsValueArg &value) {
+        SmartOptionsTarget target = { value.destVariable, value.convert, value.context, value.initial };
+        return target;
+    }
+
+    /**
+     * @brief Runs a processing function, turning an allocation failure into SMARTOPTIONS_SYSTEM_ERROR.
+     *
+     * @param process The processing function, returning a status.
+     */
+    template <typename Process>
+    SMARTOPTIONS_STATUS guardAllocation(Process process) const {
+        if (SMARTOPTIONS_SUCCESS != this->addStatus) {
+            errno = ENOMEM;
+            return this->addStatus;
+        }
+        try {
+            return process();
+        } catch (const std::bad_alloc &) {
+            errno = ENOMEM;
+            return SMARTOPTIONS_SYSTEM_ERROR;
+        }
+    }
+
+    /**
+     * @brief Retrieves the number of bytes used by the nodes of a list: the elements and their two links.
+     */
+    template <typename List>
+    static size_t listFootprint(const List &list) {
+        return list.size() * (sizeof(typename List::value_type) + 2 * sizeof(void *));
+    }
+
+#if defined(SMARTOPTIONS_TELEMETRY)
+    /**
+     * @brief Retrieves the name an option is written with in the telemetry file, see FlushTelemetry().
+     */
+    static std::string telemetryName(char prefixShort, const char *prefixLong, const char *metaVariable) {
+        if (NULL != prefixLong) return prefixLong;
+        if (0 != prefixShort) return std::string(1, prefixShort);
+        return (NULL != metaVariable) ? metaVariable : "";
+    }
+#endif
+
+    /**
+     * @brief Counts a hit of every option bound in the current result, when SMARTOPTIONS_TELEMETRY is defined, see
+     * HitCount().
+     */
+    void countHits() const {
+#if defined(SMARTOPTIONS_TELEMETRY)
+        for (size_t position = 0; NULL != this->telemetry && position < this->result.BindingCount(); position++) {
+            this->telemetry->Hit(this->result.Binding(position).id);
+        }
+#endif
+    }
+
+    /**
+     * @brief Writes a command line parameter of BuildArgv(): the option and its value, quoted if requested.
+     *
+     * @param out The buffer, or NULL to only measure the parameter.
+     * @param prefixShort The option, 0 for the program name and positional arguments.
+     * @param value The value.
+     * @param isShellQuoted Quotes the parameter for a POSIX shell, where needed.
+     *
+     * @returns The length of the parameter, without the terminating '\0'.
+     */
+    static size_t writeArgvToken(char *out, char prefixShort, const char *value, bool isShellQuoted) {
+        static const char SHELL_SAFE[] = "@%+=:,./-_";
+        size_t valueLength = strlen(value);
+        bool isQuoted = false;
+        if (isShellQuoted) {
+            isQuoted = (0 == prefixShort) ? (0 == valueLength)
+                     : (0 == isalnum((unsigned char)prefixShort) && NULL == strchr(SHELL_SAFE, prefixShort));
+            for (size_t i = 0; i < valueLength && false == isQuoted; i++) {
+                isQuoted = (0 == isalnum((unsigned char)value[i]) && NULL == strchr(SHELL_SAFE, value[i]));
+            }
+        }
+
+        size_t length = 0;
+        auto put = [&](char c) {
+            if (out) out[length] = c;
+            length++;
+        };
+        if (isQuoted) put('\'');
+        if (0 != prefixShort) {
+            put('-');
+            put(prefixShort);
+        }
+        for (size_t i = 0; i < valueLength; i++) {
+            if (isQuoted && '\'' == value[i]) {
+                // Close the quotes, add an escaped quote, and reopen them...
+                put('\''); put('\\'); put('\''); put('\'');
+            } else {
+                put(value[i]);
+            }
+        }
+        if (isQuoted) put('\'');
+        if (out) out[length] = NULL_TERMINATE;
+        return length;
+    }
+
+    /**
+     * @brief Renders a result as JSON, see ToJson().
+     */
+    void renderJson(const SmartOptionsResult &result, SmartOptionsJsonWriter &writer) const {
+        static const char *KIND_NAMES[] = { "flag", "option", "value", "positional" };
+        static const char *SOURCE_NAMES[] = { "default", "command-line", "environment", "response-file" };
+
+        writer.raw("{\"program\":");
+        writer.string(this->appName);
+        writer.raw(",\"options\":[");
+        for (size_t id = 0; id < this->entries.size(); id++) {
+            const SmartOptionsEntry &entry = this->entries[id];
+            if (0 != id) writer.raw(",", 1);
+            writer.raw("{\"id\":");
+            writer.number(id);
+            writer.raw(",\"kind\":");
+            writer.string(KIND_NAMES[entry.kind]);
+            if (SMARTOPTIONS_ARG_POSITIONAL == entry.kind) {
+                writer.raw(",\"name\":");
+                writer.string(this->helpTexts[id].metaVariable);
+            } else {
+                writer.raw(",\"short\":");
+                writer.string(&entry.prefixShort, 1);
+                writer.raw(",\"long\":");
+                writer.string(entry.prefixLong);
+            }
+            writer.raw(",\"source\":");
+            writer.string(SOURCE_NAMES[result.Source((unsigned)id)]);
+            if (SMARTOPTIONS_ARG_FLAG == entry.kind) {
+                writer.raw(",\"value\":");
+                writer.raw(result.IsSet((unsigned)id) ? "true" : "false");
+            } else {
+                writer.raw(",\"values\":[");
+                for (const SmartOptionsBinding *binding = result.FirstBinding((unsigned)id); NULL != binding; binding = result.NextBinding(binding)) {
+                    if (binding != result.FirstBinding((unsigned)id)) writer.raw(",", 1);
+                    writer.string(binding->value);
+                }
+                writer.raw("]", 1);
+            }
+            writer.raw("}", 1);
+        }
+        writer.raw("]}", 2);
+    }
+
+    /**
+     * @brief Processes a single command line parameter, together with its value, if it is passed separately.
+     *
+     * @param argc The number of command line parameters.
+     * @param argv The command line parameters, an array or a SmartOptionsTokenChain.
+     * @param index The index of the parameter, advanced past the value of the option.
+     * @param posArgsCount The number of positional arguments processed so far, advanced for positional arguments.
+     * @param strPosArgErrMsg Collects the extra positional arguments, for the error message.
+     * @param result Receives the bindings.
+     * @param isApplied Updates the variables and reports the errors, otherwise the values are only checked.
+     * @param scratches The values the repeatable options accumulate into, when the values are only checked.
+     *
+     * @returns The same codes as ProcessCommandArgs().
+     */
+    template <typename Tokens>
+    SMARTOPTIONS_STATUS processToken(int argc, const Tokens &argv, int &index, size_t &posArgsCount, std::string &strPosArgErrMsg,
+                                     SmartOptionsResult &result, bool isApplied, SmartOptionsScratchList *scratches = NULL) const {
+        const int start = index;
+        const char *token = argv[index];
+        const SMARTOPTIONS_SOURCE source = SmartOptions::tokenSource(argv, index);
+        std::string strErrMessage;
+        bool isTokenProcessed = false;
+        if ('-' == token[0])
+        {
+            token++; // increment the token pointer
+            isTokenProcessed = false; // reset...
+
+            // First Process Flags...
+            if (false == isTokenProcessed) {
+                for (SmartOptionsFlagArgList::const_iterator flagsIt =  this->flags.begin();
+                        flagsIt != this->flags.end();
+                        flagsIt++)
+                {
+                    if ( (*flagsIt).prefixShort == (*(char*)token) ) {
+                        // Update the variable that has been passed while configuring...
+                        if (isApplied) (*flagsIt->destVariable) = true;
+                        result.bind(flagsIt->id, source, NULL, start, 1, this->entries[flagsIt->id]);
+
+                        isTokenProcessed = true;
+                        break;
+                    }
+                }
+            }
+
+            // Second Process Options...
+            if (false == isTokenProcessed) {
+                for (SmartOptionsOptionArgList::const_iterator optionsIt =  this->options.begin();
+                        optionsIt != this->options.end();
+                        optionsIt++)
+                {
+                    if ( (*optionsIt).prefixShort == (*(char*)token) ) {
+                        SmartOptionsOptionArg optionArg = (SmartOptionsOptionArg)(*optionsIt);
+                        
+                        // Update the variable that has been passed while configuring...
+                        const char *optionStr = fetchOptionValue(argc, argv, token, index, strErrMessage);
+                        if (optionStr) {
+                            if (isApplied) *(optionArg.destVariable) = optionStr;
+                            result.bind(optionArg.id, source, optionStr, start, index - start + 1, this->entries[optionArg.id]);
+                            isTokenProcessed = true;
+                        }
+                    }
+
+                    if (isTokenProcessed) break;
+                }
+            }
+
+            // Third Process Typed Options...
+            if (false == isTokenProcessed && strErrMessage.empty()) {
+                for (SmartOptionsValueArgList::const_iterator valuesIt =  this->values.begin();
+                        valuesIt != this->values.end();
+                        valuesIt++)
+                {
+                    if ( (*valuesIt).prefixShort != (*(char*)token) ) continue;
+
+                    const char *valueStr = fetchOptionValue(argc, argv, token, index, strErrMessage);
+                    if (valueStr) {
+                        // The hash covers the value the values of a repeatable option accumulate into, from the
+                        // default of the variable...
+                        std::string strReason;
+                        uint64_t valueHash = 0;
+                        SMARTOPTIONS_STATUS status = SMARTOPTIONS_SUCCESS;
+                        if (isApplied) {
+                            status = valuesIt->convert(valueStr, valuesIt->destVariable, valuesIt->context, strReason);
+                            if (SMARTOPTIONS_SUCCESS == status && NULL != valuesIt->hash) valueHash = valuesIt->hash(valuesIt->destVariable);
+                        } else if (this->entries[valuesIt->id].isRepeatable && NULL != valuesIt->hash) {
+                            void *scratch = this->scratchOf(*valuesIt, *scratches);
+                            status = valuesIt->convert(valueStr, scratch, valuesIt->context, strReason);
+                            if (SMARTOPTIONS_SUCCESS == status) valueHash = valuesIt->hash(scratch);
+                        } else {
+                            status = valuesIt->check(*valuesIt, valueStr, strReason, valueHash);
+                        }
+                        if (SMARTOPTIONS_SUCCESS != status) {
+                            if (isApplied && this->autoPrintHelp) {
+                                std::cout << std::string(this->appName) << ": Error, invalid value '" << valueStr << "' for '-"
+                                          << valuesIt->prefixShort << "' option" << strReason << "." << std::endl;
+                            }
+                            if (isApplied) AutoPrintHelp();
+                            return status;
+                        }
+                        result.bind(valuesIt->id, source, valueStr, start, index - start + 1, this->entries[valuesIt->id],
+                                    (NULL != valuesIt->hash) ? &valueHash : NULL);
+                        isTokenProcessed = true;
+                    }
+                    break;
+                }
+            }
+
+            // Fourth Process the Options of the attached Plugins...
+            for (size_t pluginIndex = 0; false == isTokenProcessed && strErrMessage.empty() && pluginIndex < this->plugins.size(); pluginIndex++) {
+                const SmartOptionsPluginLink &plugin = this->plugins[pluginIndex];
+                for (size_t member = 0; member < plugin.table->memberCount; member++) {
+                    const SmartOptionsMember &option = plugin.table->members[member];
+                    if (option.prefixShort != (*(char*)token)) continue;
+
+                    const unsigned id = plugin.firstId + (unsigned)member;
+                    const char *valueStr = option.isFlag ? NULL : fetchOptionValue(argc, argv, token, index, strErrMessage);
+                    if (option.isFlag || valueStr) {
+                        SMARTOPTIONS_STATUS status = isApplied ? option.convert(valueStr, (char *)plugin.table->storage + option.offset)
+                                                    : option.check(valueStr);
+                        if (SMARTOPTIONS_SUCCESS != status) {
+                            if (isApplied && this->autoPrintHelp) {
+                                std::cout << std::string(this->appName) << ": Error, invalid value '" << valueStr << "' for '-"
+                                          << option.prefixShort << "' option." << std::endl;
+                            }
+                            if (isApplied) AutoPrintHelp();
+                            return status;
+                        }
+                        result.bind(id, source, valueStr, start, index - start + 1, this->entries[id]);
+                        isTokenProcessed = true;
+                    }
+                    break;
+                }
+            }
+
+            // Flag error, if the token is not processed...
+            if (false == isTokenProcessed) {
+                if (isApplied && this->autoPrintHelp) {
+                    if (strErrMessage.empty() == false)
+                        std::cout << std::string(this->appName) << strErrMessage << std::endl;
+                    else
+                        std::cout << std::string(this->appName) << ": Error, invalid argument '-" << token[0] << "'." << std::endl;
+                }
+                if (isApplied) AutoPrintHelp();
+                return SMARTOPTIONS_INVALID_ARGUMENT;
+            }
+        } else {
+            // lastly process the Positional arguments...
+            if (posArgsCount < this->posArgs.size()) {
+                SmartOptionsPositionalArg posArg = this->posArgs[posArgsCount];
+
+                // Update the variable that has been passed while configuring...
+                if (isApplied) *(posArg.destVariable) = token;
+                result.bind(posArg.id, source, token, start, 1, this->entries[posArg.id]);
+            }
+            else {
+                if (strPosArgErrMsg.empty() == true) {
+                    strPosArgErrMsg = std::string(this->appName) + ": Error, invalid number of mandatory arguments (" + token;
+                }
+                else {
+                    strPosArgErrMsg += std::string(", ") + token;
+                }
+            }
+            posArgsCount++;
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Checks the number of positional arguments, once the command line has been processed.
+     *
+     * @param posArgsCount The number of positional arguments passed.
+     * @param strPosArgErrMsg The extra positional arguments, for the error message.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if all the positional arguments, and no more, have been passed.
+     * @retval SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS otherwise.
+     */
+    SMARTOPTIONS_STATUS validatePositionalCount(size_t posArgsCount, std::string &strPosArgErrMsg) {
+        // This means that we have extra positional arguments, hence fix the error message.
+        if (strPosArgErrMsg.empty() == false) {
+            strPosArgErrMsg += ")";
+            size_t loc = strPosArgErrMsg.rfind(",");
+            strPosArgErrMsg.replace(loc, 1, " &"); // Replace a single comma with space and ampersand.
+        }
+
+        // Post processing validations...
+        if ( posArgsCount != this->posArgs.size() ) {
+
+            // In case where in we don't have sufficient mandatory parameters...
+            if (strPosArgErrMsg.empty() == true) {
+                strPosArgErrMsg = std::string(this->appName) + ": Error, invalid number of mandatory arguments";
+            }
+
+            if (this->autoPrintHelp) {
+                if (this->posArgs.size() == 1) {
+                    strPosArgErrMsg += ". The only mandatory parameter is '" + std::string(this->helpTexts[this->posArgs.begin()->id].metaVariable) + "'";
+                }
+                else {
+                    strPosArgErrMsg += ". The mandatory parameters are ";   
+                    for (SmartOptionsPositionalArgList::iterator posArgsIt =  this->posArgs.begin(); posArgsIt != this->posArgs.end(); posArgsIt++) {
+                        SmartOptionsPositionalArg posArg = (SmartOptionsPositionalArg)(*posArgsIt);
+                        strPosArgErrMsg += std::string("'") + this->helpTexts[posArg.id].metaVariable + "', ";
+                    }
+                    strPosArgErrMsg.erase(strPosArgErrMsg.size() -2); // Remove last 2 characters ", ".
+                    size_t loc = strPosArgErrMsg.rfind(",");
+                    strPosArgErrMsg.replace(loc, 1, " &"); // Replace a single comma with space and ampersand.
+                    strPosArgErrMsg += ".";
+                }
+                std::cout << strPosArgErrMsg << std::endl;
+            }
+
+            this->AutoPrintHelp();
+            return SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS;
+        }
+
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Copies the values of the variables of all the options, the first time a command line is processed
+     * after they have been added.
+     */
+    void saveDefaults() {
+        for (size_t id = 0; id < this->targets.size(); id++) {
+            this->targets[id].initial.Save(this->targets[id].variable, this->entries.get_allocator().resource());
+        }
+    }
+
+    /**
+     * @brief Restores the variables of the options passed in the current result to their defaults, before another
+     * command line is processed.
+     */
+    void restorePassed() {
+        for (unsigned id = 0; id < this->result.OptionCount(); id++) {
+            if (this->result.IsSet(id)) this->targets[id].initial.Restore(this->targets[id].variable);
+        }
+    }
+
+    /**
+     * @brief Updates the variables of the options affected by an edit, from their remaining values. The variables
+     * of the options which are no longer passed are restored to their defaults, whatever their kind.
+     *
+     * @param affected The IDs of the affected options.
+     */
+    void updateAffected(const std::vector<unsigned> &affected) {
+        for (size_t index = 0; index < affected.size(); index++) {
+            const unsigned id = affected[index];
+            const SmartOptionsTarget &target = this->targets[id];
+            if (false == this->result.IsSet(id)) {
+                target.initial.Restore(target.variable);
+            } else if (SMARTOPTIONS_ARG_FLAG == this->entries[id].kind) {
+                *static_cast<bool *>(target.variable) = true;
+            } else if (NULL == target.convert) {
+                *static_cast<const char **>(target.variable) = this->result.Value(id);
+            } else if (false == this->entries[id].isRepeatable) {
+                // The values of repeatable options have been applied in order, and the last value has been converted before...
+                std::string strReason;
+                target.convert(this->result.Value(id), target.variable, target.context, strReason);
+            }
+        }
+    }
+
+    /**
+     * @brief Retrieves the scratch value of a repeatable option, while a command line is only parsed, and creates it
+     * from the default of its variable when the option is first passed.
+     *
+     * @param value The option.
+     * @param scratches The scratch values of the options passed so far.
+     */
+    void *scratchOf(const SmartOptionsValueArg &value, SmartOptionsScratchList &scratches) const {
+        for (size_t index = 0; index < scratches.size(); index++) {
+            if (value.id == scratches[index].id) return scratches[index].value.get();
+        }
+        SmartOptionsScratch scratch = { value.id, this->targets[value.id].initial.Copy(value.destVariable) };
+        scratches.push_back(scratch);
+        return scratches.back().value.get();
+    }
+
+    /**
+     * @brief Retrieves the value of an option, which is either attached to the option (-w100) or passed as the
+     * next command line parameter (-w 100).
+     *
+     * @param argc The number of command line parameters.
+     * @param argv The command line parameters, an array or a SmartOptionsTokenChain.
+     * @param token The option token, without the leading '-'.
+     * @param index The index of the option token, advanced when the value is the next command line parameter.
+     * @param errMessage Receives the error message, if the value is missing.
+     *
+     * @returns The value string, or NULL if the value is missing.
+     */
+    template <typename Tokens>
+    static const char *fetchOptionValue(int argc, const Tokens &argv, const char *token, int &index, std::string &errMessage) {
+        if (SmartOptions::NULL_TERMINATE != token[1]) {
+            // If the argument provided is not separated by space...
+            return token + 1;
+        }
+        if (index >= (argc-1)) {
+            errMessage = std::string(": Error, missing value for '-") + token[0] + "' option.";
+            return NULL;
+        }
+        // If the argument provided is separated by space...
+        return argv[++index];
+    }
+
+    /**
+     * @brief Converts the value of an enum option, see SmartOptionsConvertFn.
+     */
+    template <typename E, size_t N>
+    static SMARTOPTIONS_STATUS convertEnum(const char *value, void *destVariable, const void *context, std::string &errMessage) {
+        const SmartOptionsChoices<E, N> *choices = static_cast<const SmartOptionsChoices<E, N> *>(context);
+        if (choices->Lookup(value, *static_cast<E *>(destVariable))) {
+            return SMARTOPTIONS_SUCCESS;
+        }
+        errMessage = ", valid choices are ";
+        choices->Describe(errMessage);
+        return SMARTOPTIONS_INVALID_ARGUMENT;
+    }
+
+    /**
+     * @brief Sets or clears a bit in a 64 bit feature mask.
+     *
+     * @returns false if the bit is beyond the width of the mask.
+     */
+    static bool updateFeatureMask(uint64_t &mask, unsigned bit, bool isEnabled) {
+        if (bit >= 64) return false;
+        mask = isEnabled ? (mask | ((uint64_t)1 << bit)) : (mask & ~((uint64_t)1 << bit));
+        return true;
+    }
+
+    /**
+     * @brief Sets or clears a bit in a feature mask wider than 64 bits.
+     *
+     * @returns false if the bit is beyond the width of the mask.
+     */
+    template <size_t B>
+    static bool updateFeatureMask(std::bitset<B> &mask, unsigned bit, bool isEnabled) {
+        if (bit >= B) return false;
+        mask.set(bit, isEnabled);
+        return true;
+    }
+
+    /**
+     * @brief Converts the value of a feature set option, see SmartOptionsConvertFn.
+     */
+    template <typename M, size_t N>
+    static SMARTOPTIONS_STATUS convertFeatureSet(const char *value, void *destVariable, const void *context, std::string &errMessage) {
+        const SmartOptionsChoices<unsigned, N> *features = static_cast<const SmartOptionsChoices<unsigned, N> *>(context);
+        M mask = *static_cast<M *>(destVariable);
+
+        for (const char *name = value; ; ) {
+            const char *end = strchr(name, ',');
+            size_t length = end ? (size_t)(end - name) : strlen(name);
+
+            bool isEnabled = ('-' != name[0]);
+            if (false == isEnabled) {
+                name++;
+                length--;
+            }
+
+            unsigned bit = 0;
+            if (0 == length || !features->Lookup(name, length, bit)) {
+                errMessage = ", unknown feature '" + std::string(name, length) + "', valid features are ";
+                features->Describe(errMessage);
+                return SMARTOPTIONS_INVALID_ARGUMENT;
+            }
+            if (!updateFeatureMask(mask, bit, isEnabled)) {
+                errMessage = ", feature '" + std::string(name, length) + "' does not fit into the feature mask";
+                return SMARTOPTIONS_INVALID_ARGUMENT;
+            }
+
+            if (NULL == end) break;
+            name = end + 1;
+        }
+
+        *static_cast<M *>(destVariable) = mask;
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of a float or double option, see SmartOptionsConvertFn.
+     */
+    template <typename F>
+    static SMARTOPTIONS_STATUS convertFloatingPoint(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        SMARTOPTIONS_STATUS status = SmartOptionsConverter<F>::parse(std::string_view(value), *static_cast<F *>(destVariable));
+        if (SMARTOPTIONS_OUT_OF_RANGE == status) {
+            errMessage = (sizeof(F) == sizeof(float)) ? ", value is out of range for a float" : ", value is out of range for a double";
+        } else if (SMARTOPTIONS_INVALID_FORMAT == status) {
+            errMessage = ", expected a floating point number";
+        }
+        return status;
+    }
+
+    /**
+     * @brief Converts the value of an option of a user defined type through SmartOptionsConverter, see SmartOptionsConvertFn.
+     */
+    template <typename T>
+    static SMARTOPTIONS_STATUS convertCustom(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        T result = T();
+        SMARTOPTIONS_STATUS status = SmartOptionsConverter<T>::parse(std::string_view(value), result);
+        if (SMARTOPTIONS_SUCCESS == status) {
+            *static_cast<T *>(destVariable) = std::move(result);
+        } else if (SMARTOPTIONS_OUT_OF_RANGE == status) {
+            errMessage = ", value is out of range";
+        }
+        return status;
+    }
+
+    /**
+     * @brief Converts the value of a timestamp option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertTimestamp(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        SMARTOPTIONS_STATUS status = SmartOptionsConverter<SmartOptionsTimestamp>::parse(std::string_view(value), *static_cast<SmartOptionsTimestamp *>(destVariable));
+        if (SMARTOPTIONS_INVALID_FORMAT == status) {
+            errMessage = ", expected an ISO-8601 timestamp like 2024-03-01T12:30:00Z";
+        } else if (SMARTOPTIONS_OUT_OF_RANGE == status) {
+            errMessage = ", timestamp is out of range";
+        }
+        return status;
+    }
+
+    /**
+     * @brief Converts the value of a file option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertFile(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        if (SmartOptions::NULL_TERMINATE == value[0]) {
+            errMessage = ", expected a file path";
+            return SMARTOPTIONS_INVALID_ARGUMENT;
+        }
+        static_cast<SmartOptionsFileValue *>(destVariable)->assign(value, NULL);
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of a file option which accepts inline values, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertFileOrInline(const char *value, void *destVariable, const void *context, std::string &errMessage) {
+        if ('@' == value[0]) {
+            return convertFile(value + 1, destVariable, context, errMessage);
+        }
+        static_cast<SmartOptionsFileValue *>(destVariable)->assign(NULL, value);
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of an expanded option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertExpanded(const char *value, void *destVariable, const void *context, std::string &) {
+        static_cast<SmartOptionsExpandedValue *>(destVariable)->assign(value, static_cast<SmartOptionsArena *>(const_cast<void *>(context)));
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of a path option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertPath(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        if (SmartOptions::NULL_TERMINATE == value[0]) {
+            errMessage = ", expected a path";
+            return SMARTOPTIONS_INVALID_ARGUMENT;
+        }
+        *static_cast<const char **>(destVariable) = value;
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Runs the checks of a path.
+     *
+     * @param path The path to be checked.
+     * @param checks A combination of SMARTOPTIONS_PATH_CHECK values.
+     * @param reason Receives the reason, if a check fails.
+     *
+     * @returns true if all the checks pass, false otherwise.
+     */
+    static bool checkPath(const char *path, unsigned checks, std::string &reason) {
+#if defined(_WIN32)
+        struct _stat pathStat;
+        bool isPresent = (0 == _stat(path, &pathStat));
+        bool isDirectory = isPresent && (pathStat.st_mode & _S_IFDIR);
+#else
+        struct stat pathStat;
+        bool isPresent = (0 == stat(path, &pathStat));
+        bool isDirectory = isPresent && S_ISDIR(pathStat.st_mode);
+#endif
+        if ((checks & (SMARTOPTIONS_PATH_EXISTS | SMARTOPTIONS_PATH_READABLE | SMARTOPTIONS_PATH_DIRECTORY)) && !isPresent) {
+            reason = "no such file or directory";
+            return false;
+        }
+        if ((checks & SMARTOPTIONS_PATH_DIRECTORY) && !isDirectory) {
+            reason = "not a directory";
+            return false;
+        }
+#if defined(_WIN32)
+        if ((checks & SMARTOPTIONS_PATH_READABLE) && 0 != _access(path, 4)) {
+#else
+        if ((checks & SMARTOPTIONS_PATH_READABLE) && 0 != access(path, R_OK)) {
+#endif
+            reason = "permission denied";
+            return false;
+        }
+        if (checks & SMARTOPTIONS_PATH_WRITABLE_PARENT) {
+            const char *separator = strrchr(path, '/');
+#if defined(_WIN32)
+            const char *backslash = strrchr(path, '\\');
+            if (backslash > separator) separator = backslash;
+#endif
+            std::string parent = (NULL == separator) ? std::string(".") : (separator == path) ? std::string("/") : std::string(path, separator);
+#if defined(_WIN32)
+            bool isWritable = (0 == _stat(parent.c_str(), &pathStat)) && (pathStat.st_mode & _S_IFDIR) && 0 == _access(parent.c_str(), 2);
+#else
+            bool isWritable = (0 == stat(parent.c_str(), &pathStat)) && S_ISDIR(pathStat.st_mode) && 0 == access(parent.c_str(), W_OK);
+#endif
+            if (!isWritable) {
+                reason = "parent directory '" + parent + "' is not a writable directory";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Runs the checks of all the path options which have been passed, concurrently, and reports all the failures.
+     *
+     * @details If a thread can not be started, the paths are checked by the threads already started and the calling
+     * thread.
+     *
+     * @param result The result, which holds the paths.
+     * @param affected The IDs of the options to be checked, in increasing order, all of them are if NULL.
+     * @param isApplied Reports the failures.
+     *
+     * @retval SMARTOPTIONS_SUCCESS if all the checks pass.
+     * @retval SMARTOPTIONS_INVALID_ARGUMENT if any of the checks fails.
+     */
+    SMARTOPTIONS_STATUS validatePaths(const SmartOptionsResult &result, const std::vector<unsigned> *affected, bool isApplied) const {
+        std::vector<const SmartOptionsPathCheck *> pending;
+        for (SmartOptionsPathCheckList::const_iterator pathIt = this->pathChecks.begin(); pathIt != this->pathChecks.end(); pathIt++) {
+            if (NULL != affected && false == std::binary_search(affected->begin(), affected->end(), pathIt->id)) continue;
+            if (NULL != result.Value(pathIt->id) && 0 != pathIt->checks) {
+                pending.push_back(&(*pathIt));
+            }
+        }
+        if (pending.empty()) return SMARTOPTIONS_SUCCESS;
+
+        std::vector<std::string> reasons(pending.size());
+        std::vector<char> isValid(pending.size(), 1);
+        std::atomic<size_t> nextIndex(0);
+
+        // Every worker picks the next unchecked path, until none is left...
+        auto worker = [&]() {
+            for (size_t index = nextIndex++; index < pending.size(); index = nextIndex++) {
+                isValid[index] = checkPath(result.Value(pending[index]->id), pending[index]->checks, reasons[index]);
+            }
+        };
+
+        size_t threadCount = std::min<size_t>(std::min<size_t>(pending.size(), MAX_PATH_CHECK_THREADS), std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (size_t i = 1; i < threadCount; i++) {
+            try {
+                threads.emplace_back(worker);
+            } catch (const std::system_error &) {
+                break;  // No more threads, the calling thread checks the remaining paths...
+            }
+        }
+        worker();
+        for (size_t i = 0; i < threads.size(); i++) {
+            threads[i].join();
+        }
+
+        bool isAnyInvalid = false;
+        for (size_t index = 0; index < pending.size(); index++) {
+            if (isValid[index]) continue;
+            isAnyInvalid = true;
+            if (isApplied && this->autoPrintHelp) {
+                std::cout << std::string(this->appName) << ": Error, invalid path '" << result.Value(pending[index]->id) << "' for '-"
+                          << pending[index]->prefixShort << "' option, " << reasons[index] << "." << std::endl;
+            }
+        }
+        if (isAnyInvalid) {
+            if (isApplied) this->AutoPrintHelp();
+            return SMARTOPTIONS_INVALID_ARGUMENT;
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of a member of a plugin, whose SmartOptionsMember is the context, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertMember(const char *value, void *destVariable, const void *context, std::string &) {
+        return static_cast<const SmartOptionsMember *>(context)->convert(value, destVariable);
+    }
+
+    /**
+     * @brief Converts the value of an address option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertAddress(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        if (!SmartOptionsIPAddress::Parse(value, strlen(value), *static_cast<SmartOptionsIPAddress *>(destVariable))) {
+            errMessage = ", expected an IPv4 or IPv6 address";
+            return SMARTOPTIONS_INVALID_ARGUMENT;
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of an endpoint option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertEndpoint(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        if (!SmartOptionsEndpoint::Parse(value, strlen(value), *static_cast<SmartOptionsEndpoint *>(destVariable))) {
+            errMessage = ", expected host:port or [IPv6 address]:port";
+            return SMARTOPTIONS_INVALID_ARGUMENT;
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of a prefix option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertPrefix(const char *value, void *destVariable, const void *, std::string &errMessage) {
+        if (!SmartOptionsIPPrefix::Parse(value, strlen(value), *static_cast<SmartOptionsIPPrefix *>(destVariable))) {
+            errMessage = ", expected a network prefix (address/length) without host bits";
+            return SMARTOPTIONS_INVALID_ARGUMENT;
+        }
+        return SMARTOPTIONS_SUCCESS;
+    }
+
+    /**
+     * @brief Converts the value of a prefix table option, see SmartOptionsConvertFn.
+     */
+    static SMARTOPTIONS_STATUS convertPrefixTable(const char *value, void *destVariable, const void *context, std::string &errMessage) {
+        SmartOptionsIPPrefix prefix;
+        SMARTOPTIONS_STATUS status = convertPrefix(value, &prefix, context, errMessage);
+        if (SMARTOPTIONS_SUCCESS == status) {
+            static_cast<SmartOptionsIPPrefixTable *>(destVariable)->Insert(prefix);
+        }
+        return status;
+    }
+
+    /**
+     * @brief Prints the description and the help message of the flags and options.
+     *
+     * @param isShown Selects the options by their ID, NULL prints all of them.
+     */
+    void printHelp(const std::vector<char> *isShown) const {
+        printf("%s %s \n", this->appName, this->usage);
+        //printf("%s \n", this->description);
+
+        char leftContent[64] = {0};
+
+        for (SmartOptionsOptionArgList::const_iterator optionsIt =  this->options.begin();
+                optionsIt != this->options.end();
+                optionsIt++)
+        {
+            if (NULL != isShown && 0 == (*isShown)[optionsIt->id]) continue;
+            const SmartOptionsHelpText &text = this->helpTexts[optionsIt->id];
+
+            sprintf(leftContent, "  -%c <%s> ", optionsIt->prefixShort, text.metaVariable);
+            printf("%-32s %s \n", leftContent, text.helpString);
+        }
+
+        for (SmartOptionsValueArgList::const_iterator valuesIt =  this->values.begin();
+                valuesIt != this->values.end();
+                valuesIt++)
+        {
+            if (NULL != isShown && 0 == (*isShown)[valuesIt->id]) continue;
+            const SmartOptionsHelpText &text = this->helpTexts[valuesIt->id];
+
+            sprintf(leftContent, "  -%c <%s> ", valuesIt->prefixShort, text.metaVariable);
+            printf("%-32s %s \n", leftContent, text.helpString);
+        }
+
+        for (SmartOptionsFlagArgList::const_iterator flagsIt =  this->flags.begin();
+                                    flagsIt != this->flags.end();
+                                    flagsIt++)
+        {
+            if (NULL != isShown && 0 == (*isShown)[flagsIt->id]) continue;
+            sprintf(leftContent, "  -%c", flagsIt->prefixShort);
+            printf("%-32s %s \n", leftContent, this->helpTexts[flagsIt->id].helpString);
+        }
+
+        for (size_t pluginIndex = 0; pluginIndex < this->plugins.size(); pluginIndex++) {
+            const SmartOptionsPluginLink &plugin = this->plugins[pluginIndex];
+            for (size_t member = 0; member < plugin.table->memberCount; member++) {
+                const SmartOptionsMember &option = plugin.table->members[member];
+                if (NULL != isShown && 0 == (*isShown)[plugin.firstId + member]) continue;
+
+                if (option.isFlag) sprintf(leftContent, "  -%c", option.prefixShort);
+                else sprintf(leftContent, "  -%c <%s> ", option.prefixShort, option.metaVariable);
+                printf("%-32s %s \n", leftContent, option.helpString);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether a text contains a keyword, ignoring case.
+     *
+     * @param text The text, may be NULL.
+     * @param keyword The keyword.
+     */
+    static bool containsKeyword(const char *text, const char *keyword) {
+        if (NULL == text) return false;
+        for (; '\0' != *text; text++) {
+            size_t index = 0;
+            while ('\0' != keyword[index] && tolower((unsigned char)text[index]) == tolower((unsigned char)keyword[index])) index++;
+            if ('\0' == keyword[index]) return true;
+        }
+        return '\0' == *keyword;
+    }
+
+    /**
+     * @brief Checks whether the text of an option contains a keyword, see SearchHelp().
+     */
+    bool matchesHelp(unsigned id, const char *keyword) const {
+        const SmartOptionsEntry &entry = this->entries[id];
+        if ('\0' != keyword[0] && '\0' == keyword[1]) return keyword[0] == entry.prefixShort;
+        return SmartOptions::containsKeyword(entry.prefixLong, keyword) ||
+               SmartOptions::containsKeyword(this->helpTexts[id].metaVariable, keyword) ||
+               SmartOptions::containsKeyword(this->helpTexts[id].helpString, keyword);
+    }
+
+    /**
+     * @brief Print help if Auto-Help option is enabled...
+     */
+    void AutoPrintHelp() const {
+        if (true == this->autoPrintHelp) {
+            this->PrintHelp();
         }
     }
 
@@ -517,9 +5681,216 @@ private: // Private Member variables...
     SmartOptionsOptionArgList       options;    //!< @brief A list containing all the Command Line Options argument rules.
     SmartOptionsFlagArgList         flags;      //!< @brief A list containing all the Command Line Flag argument rules.
     SmartOptionsPositionalArgList   posArgs;    //!< @brief A list containing all the Command Line Positional argument rules.
+    SmartOptionsValueArgList        values;     //!< @brief A list containing all the typed Command Line Option argument rules.
+    SmartOptionsPathCheckList       pathChecks; //!< @brief A list containing the checks of all the path options.
+    std::pmr::vector<SmartOptionsEntry> entries;    //!< @brief The description of all the options, indexed by the option ID.
+    SmartOptionsHelpTextList helpTexts;         //!< @brief The help text of all the options, indexed by the option ID.
+    SmartOptionsHelpIndex helpIndex;            //!< @brief The index of the help text, see BuildHelpIndex().
+    SmartOptionsPluginLinkList plugins;         //!< @brief The option tables of the attached plugins.
+    SmartOptionsTargetList targets;             //!< @brief The variables of all the options, indexed by the option ID.
+#if defined(SMARTOPTIONS_TELEMETRY)
+    SmartOptionsTelemetry *telemetry;           //!< @brief The counters of the process, NULL if the hits are not counted.
+#endif
+
+    SmartOptionsResult result;  //!< @brief The result of processing the current command line.
+    SMARTOPTIONS_STATUS resultStatus;   //!< @brief The status of processing the current command line.
+    SMARTOPTIONS_STATUS addStatus;      //!< @brief SMARTOPTIONS_SYSTEM_ERROR once an option could not be added.
+
+    std::shared_ptr<SmartOptionsArena> arena;   //!< @brief The arena for strings created from the current command line.
 
     static const char NULL_TERMINATE = '\0';
+    static constexpr size_t MAX_PATH_CHECK_THREADS = 8;   //!< @brief The maximum number of threads checking paths concurrently.
+
+};
+
+/**
+ * @brief Publishes the options of a long running parser service, and replaces them at run time without
+ * blocking the threads which are processing command lines.
+ *
+ * @details Every request acquires the current options, and processes its command line with them through
+ * SmartOptions::Parse(); the options stay valid until the request releases them, even if new options are
+ * published meanwhile. The published options are reclaimed with hazard pointers: acquiring and releasing
+ * them never waits, and replaced options are deleted by Publish() or Reclaim() once no request uses them.
+ * @code
+    SmartOptionsSpecPublisher publisher(std::unique_ptr<const SmartOptions>(new SmartOptions(spec)));
+
+    // In any number of request threads...
+    SmartOptionsSpecPublisher::Guard options = publisher.Acquire();
+    SmartOptionsResult result;
+    SMARTOPTIONS_STATUS status = options->Parse(argc, argv, result);
+
+    // When new command definitions arrive...
+    publisher.Publish(std::unique_ptr<const SmartOptions>(new SmartOptions(newSpec)));
+   @endcode
+ */
+class SmartOptionsSpecPublisher {
+private:
+    /**
+     * @brief Announces the options a request is using, records are reused and only deleted with the publisher.
+     */
+    struct HazardRecord {
+        std::atomic<const SmartOptions *> hazard;   //!< @brief The options in use, NULL if none.
+        std::atomic<bool> isActive;                 //!< @brief The record is owned by a request.
+        HazardRecord *next;                         //!< @brief The next record.
+    };
+
+public:
+    /**
+     * @brief The options acquired by a request, released when the guard is destroyed.
+     */
+    class Guard {
+    public:
+        Guard(Guard &&other) : record(other.record), spec(other.spec) {
+            other.record = NULL;
+            other.spec = NULL;
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+        ~Guard() {
+            if (NULL != this->record) {
+                this->record->hazard.store(NULL, std::memory_order_release);
+                this->record->isActive.store(false, std::memory_order_release);
+            }
+        }
+
+        const SmartOptions *operator->() const {
+            return this->spec;
+        }
+
+        const SmartOptions &operator*() const {
+            return *this->spec;
+        }
+
+    private:
+        friend class SmartOptionsSpecPublisher;
+
+        Guard(HazardRecord *record, const SmartOptions *spec) : record(record), spec(spec) {}
+
+        HazardRecord *record;       //!< @brief The record announcing the options.
+        const SmartOptions *spec;   //!< @brief The options.
+    };
+
+    /**
+     * @brief The Constructor.
+     *
+     * @param spec The options published first.
+     */
+    explicit SmartOptionsSpecPublisher(std::unique_ptr<const SmartOptions> spec)
+    : current(spec.release()),
+      records(NULL)
+    {
+    }
+
+    /**
+     * @brief The Destructor, no request may be using the options any more.
+     */
+    ~SmartOptionsSpecPublisher() {
+        delete this->current.load();
+        for (size_t index = 0; index < this->retired.size(); index++) {
+            delete this->retired[index];
+        }
+        for (HazardRecord *record = this->records.load(); NULL != record; ) {
+            HazardRecord *next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    SmartOptionsSpecPublisher(const SmartOptionsSpecPublisher &) = delete;
+    SmartOptionsSpecPublisher &operator=(const SmartOptionsSpecPublisher &) = delete;
+
+    /**
+     * @brief Acquires the current options for a request, never waits.
+     */
+    Guard Acquire() const {
+        HazardRecord *record = this->acquireRecord();
+
+        // Announce the options, and make sure they are still the current ones, so they are not reclaimed...
+        const SmartOptions *spec = this->current.load();
+        for (;;) {
+            record->hazard.store(spec);
+            const SmartOptions *latest = this->current.load();
+            if (latest == spec) break;
+            spec = latest;
+        }
+        return Guard(record, spec);
+    }
+
+    /**
+     * @brief Publishes new options, the requests acquiring options from now on use them. The replaced options
+     * are deleted as soon as no request uses them any more.
+     *
+     * @param spec The new options.
+     */
+    void Publish(std::unique_ptr<const SmartOptions> spec) {
+        const SmartOptions *replaced = this->current.exchange(spec.release());
+
+        std::lock_guard<std::mutex> lock(this->retiredMutex);
+        this->retired.push_back(replaced);
+        this->reclaim();
+    }
+
+    /**
+     * @brief Deletes the replaced options, which are not used by any request any more.
+     *
+     * @returns The number of replaced options, which are still in use.
+     */
+    size_t Reclaim() {
+        std::lock_guard<std::mutex> lock(this->retiredMutex);
+        this->reclaim();
+        return this->retired.size();
+    }
+
+private:
+    /**
+     * @brief Takes over a free record, or adds a new one.
+     */
+    HazardRecord *acquireRecord() const {
+        for (HazardRecord *record = this->records.load(std::memory_order_acquire); NULL != record; record = record->next) {
+            bool isActive = false;
+            if (false == record->isActive.load(std::memory_order_relaxed)
+                    && record->isActive.compare_exchange_strong(isActive, true, std::memory_order_acquire)) {
+                return record;
+            }
+        }
+
+        HazardRecord *record = new HazardRecord;
+        record->hazard.store(NULL, std::memory_order_relaxed);
+        record->isActive.store(true, std::memory_order_relaxed);
+        record->next = this->records.load(std::memory_order_relaxed);
+        while (false == this->records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return record;
+    }
+
+    /**
+     * @brief Deletes the replaced options, which are not announced in any record, with retiredMutex held.
+     */
+    void reclaim() {
+        std::vector<const SmartOptions *> hazards;
+        for (HazardRecord *record = this->records.load(); NULL != record; record = record->next) {
+            const SmartOptions *hazard = record->hazard.load();
+            if (NULL != hazard) hazards.push_back(hazard);
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        size_t kept = 0;
+        for (size_t index = 0; index < this->retired.size(); index++) {
+            if (std::binary_search(hazards.begin(), hazards.end(), this->retired[index])) {
+                this->retired[kept++] = this->retired[index];
+            } else {
+                delete this->retired[index];
+            }
+        }
+        this->retired.resize(kept);
+    }
 
+    std::atomic<const SmartOptions *> current;          //!< @brief The current options.
+    mutable std::atomic<HazardRecord *> records;        //!< @brief The records of all the requests, ever.
+    std::mutex retiredMutex;                            //!< @brief Serializes publishing and reclaiming, never taken by requests.
+    std::vector<const SmartOptions *> retired;          //!< @brief The replaced options, which may still be in use.
 };
 
 #endif /* _SMARTOPTIONS_H */
\ No newline at end of file
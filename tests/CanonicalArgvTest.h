@@ -0,0 +1,119 @@
+/**
+ * @file        CanonicalArgvTest.h
+ *
+ * @brief       Test the canonical command line built from parse results.
+ *
+ * @details     This file contains a CxxTest test-suite to test BuildArgv() of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+static bool SkipFlags(unsigned, const SmartOptionsEntry &entry, const void *)
+{
+    return SMARTOPTIONS_ARG_FLAG != entry.kind;
+}
+
+class CanonicalArgvTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testCanonicalArgv_SortedAndResolved_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_2_SM, "-v", POSITIONAL_ARGUMENT_1, OPTION_ARGUMENT_1_SM,
+                               "-v", "-a10.0.0.0/8", OPTION_ARGUMENT_1_SS "-2", "-a", "192.168.0.0/16" };
+        const char *optionO = NULL;
+        const char *optionP = NULL;
+        const char *positional = NULL;
+        bool verbose = false;
+        SmartOptionsIPPrefixTable table;
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddPrefixOption('a', "allow", "PREFIX", "Allowed prefixes", &table);
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        SmartOptionsArgv argv;
+
+        // Act
+        SMARTOPTIONS_STATUS status = smartOptions.BuildArgv(smartOptions.GetResult(), argv);
+
+        // Assert: sorted options, last value wins, every prefix is kept, positional arguments last...
+        const char *expected[] = { "SmartOptionsTest", "-a10.0.0.0/8", "-a192.168.0.0/16", "-o" OPTION_ARGUMENT_1 "-2",
+                                   "-p" OPTION_ARGUMENT_2, "-v", POSITIONAL_ARGUMENT_1 };
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(argv.Argc(), (int)SIZE_OF_ARRAY(expected));
+        for (size_t index = 0; index < SIZE_OF_ARRAY(expected) && (int)index < argv.Argc(); index++) {
+            TS_ASSERT_EQUALS(std::string(argv.Argv()[index]), expected[index]);
+        }
+        TS_ASSERT(NULL == argv.Argv()[argv.Argc()]);
+    }
+
+    void testCanonicalArgv_FilteredAndQuoted_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-v", "-o", "it's here", "-p", "plain/value" };
+        const char *optionO = NULL;
+        const char *optionP = NULL;
+        bool verbose = false;
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        SmartOptionsArgv argv;
+
+        // Act
+        SMARTOPTIONS_STATUS status = smartOptions.BuildArgv(smartOptions.GetResult(), argv, SkipFlags, NULL, true);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(argv.Argc(), 3);
+        TS_ASSERT_EQUALS(std::string(argv.Argv()[1]), "'-oit'\\''s here'");
+        TS_ASSERT_EQUALS(std::string(argv.Argv()[2]), "-pplain/value");
+    }
+
+    void testCanonicalArgv_EmptyValue_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-o", "", "-v", POSITIONAL_ARGUMENT_1 };
+        const char *optionO = NULL;
+        const char *positional = NULL;
+        bool verbose = false;
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        SmartOptionsArgv argv;
+        SmartOptionsArgv quoted;
+
+        // Act: build the command line, and process it again...
+        SMARTOPTIONS_STATUS status = smartOptions.BuildArgv(smartOptions.GetResult(), argv);
+        SMARTOPTIONS_STATUS quotedStatus = smartOptions.BuildArgv(smartOptions.GetResult(), quoted, NULL, NULL, true);
+        optionO = NULL;
+        positional = NULL;
+        SMARTOPTIONS_STATUS roundTripStatus = smartOptions.ProcessCommandArgs(argv.Argc(), (const char **)argv.Argv());
+
+        // Assert: the empty value is a parameter of its own, it does not take the positional argument...
+        const char *expected[] = { "SmartOptionsTest", "-o", "", "-v", POSITIONAL_ARGUMENT_1 };
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(argv.Argc(), (int)SIZE_OF_ARRAY(expected));
+        for (size_t index = 0; index < SIZE_OF_ARRAY(expected) && (int)index < argv.Argc(); index++) {
+            TS_ASSERT_EQUALS(std::string(argv.Argv()[index]), expected[index]);
+        }
+        TS_ASSERT_EQUALS(quotedStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(std::string(quoted.Argv()[2]), "''");
+        TS_ASSERT_EQUALS(roundTripStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT(NULL != optionO && std::string(optionO).empty());
+        TS_ASSERT_SAME_DATA(positional, POSITIONAL_ARGUMENT_1, strlen(POSITIONAL_ARGUMENT_1));
+    }
+};
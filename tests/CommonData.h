@@ -39,3 +39,84 @@
 
 #define OPTION_ARGUMENT_2_SM "-p", OPTION_ARGUMENT_2
 #define OPTION_ARGUMENT_2_LM "-optionP", OPTION_ARGUMENT_2
+
+
+#define ENUM_PREFIX_SHORT 'm'
+#define ENUM_PREFIX_LONG "mode"
+#define ENUM_META "MODE"
+#define ENUM_HELP "Help message for Enum Option"
+
+#define ENUM_ARGUMENT_SS "-mparanoid"
+#define ENUM_ARGUMENT_SM "-m", "safe"
+#define ENUM_ARGUMENT_INVALID "-m", "reckless"
+
+
+#define FEATURE_PREFIX_SHORT 'f'
+#define FEATURE_PREFIX_LONG "features"
+#define FEATURE_META "FEATURES"
+#define FEATURE_HELP "Help message for Feature Set Option"
+
+
+#define NET_PREFIX_SHORT 'n'
+#define NET_PREFIX_LONG "listen"
+#define NET_META "ADDRESS"
+#define NET_HELP "Help message for Network Option"
+
+
+#define FLOAT_PREFIX_SHORT 'r'
+#define FLOAT_PREFIX_LONG "ratio"
+#define FLOAT_META "RATIO"
+#define FLOAT_HELP "Help message for Floating Point Option"
+
+
+#define TIME_PREFIX_SHORT 's'
+#define TIME_PREFIX_LONG "since"
+#define TIME_META "TIMESTAMP"
+#define TIME_HELP "Help message for Timestamp Option"
+
+
+#define FILE_PREFIX_SHORT 'q'
+#define FILE_PREFIX_LONG "query"
+#define FILE_META "@FILE"
+#define FILE_HELP "Help message for File Option"
+
+#define FILE_PATH "SmartOptionsFileArgTest.tmp"
+#define FILE_CONTENT "SELECT * FROM options WHERE used = 1;"
+
+
+#define PATH_PREFIX_SHORT 'i'
+#define PATH_PREFIX_LONG "input"
+#define PATH_META "PATH"
+#define PATH_HELP "Help message for Path Option"
+
+#define PATH_FILE "SmartOptionsPathArgTest.tmp"
+#define PATH_MISSING "SmartOptionsPathArgTest.missing"
+
+
+#define EXPAND_PREFIX_SHORT 'e'
+#define EXPAND_PREFIX_LONG "expand"
+#define EXPAND_META "VALUE"
+#define EXPAND_HELP "Help message for Expanded Option"
+
+
+#define CUSTOM_PREFIX_SHORT 'k'
+#define CUSTOM_PREFIX_LONG "shard"
+#define CUSTOM_META "KEY"
+#define CUSTOM_HELP "Help message for User Defined Option"
+
+
+#define JSON_FLAG_SHORT 'v'
+#define JSON_FLAG_LONG "verbose"
+#define JSON_FLAG_HELP "Help message for Flag in JSON dump"
+
+
+#define TELEMETRY_FILE_PATH "SmartOptionsTelemetryTest.tmp"
+
+
+#define CHAIN_ENV_NAME "SMARTOPTIONS_TOOL_OPTIONS"
+#define CHAIN_FILE_PATH "SmartOptionsTokenChainTest.tmp"
+
+
+#define PLUGIN_NAME "SmartOptionsTestPlugin"
+#define PLUGIN_MISSING_PATH "./SmartOptionsMissingPlugin.so"
+#define PLUGIN_PATH "./bin/SmartOptionsTestPlugin.so"
@@ -0,0 +1,87 @@
+/**
+ * @file        ConstexprParseTest.h
+ *
+ * @brief       Test Compile Time Parsing.
+ *
+ * @details     This file contains a CxxTest test-suite to test the scanning of command lines in constant expressions,
+ * through SmartOptionsStructBinding::Scan().
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+struct TestDefaults {
+    const char *name;
+    const char *option;
+    int level;
+    bool verbose;
+};
+
+static constexpr SmartOptionsMember testDefaultsMembers[] = {
+    SMARTOPTIONS_MEMBER(TestDefaults, option, OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1),
+    SMARTOPTIONS_MEMBER(TestDefaults, level, 'l', "level", "LEVEL", "The level"),
+    SMARTOPTIONS_MEMBER(TestDefaults, verbose, 'v', "verbose", NULL, "Verbose output"),
+    SMARTOPTIONS_POSITIONAL_MEMBER(TestDefaults, name, "NAME", "The name"),
+};
+static constexpr SmartOptionsStructBinding<TestDefaults, SIZE_OF_ARRAY(testDefaultsMembers)> testDefaultsBinding(testDefaultsMembers);
+
+// A default command line, scanned by the compiler...
+static constexpr const char *testDefaultArgs[] = { "SmartOptions", "-l", "4", OPTION_ARGUMENT_1_SS, "-v", POSITIONAL_ARGUMENT_1 };
+static constexpr SmartOptionsScanResult<SIZE_OF_ARRAY(testDefaultsMembers)> testDefaultScan =
+    testDefaultsBinding.Scan(SIZE_OF_ARRAY(testDefaultArgs), testDefaultArgs);
+
+static_assert(SMARTOPTIONS_SUCCESS == testDefaultScan.status, "the default command line is invalid");
+static_assert(testDefaultScan.Value(testDefaultsBinding.IndexOf('l')) == "4", "unexpected value of -l");
+static_assert(testDefaultScan.Value(testDefaultsBinding.IndexOf(OPT_PREFIX_SHORT_1)) == OPTION_ARGUMENT_1, "unexpected value of -o");
+static_assert(testDefaultScan.IsSet(testDefaultsBinding.IndexOf('v')), "-v is not set");
+static_assert(testDefaultScan.Value(3) == POSITIONAL_ARGUMENT_1, "unexpected positional argument");
+
+// Conformance checks, evaluated by the compiler...
+static constexpr const char *testUnknownArgs[] = { "SmartOptions", "-x", POSITIONAL_ARGUMENT_1 };
+static constexpr const char *testMissingArgs[] = { "SmartOptions", POSITIONAL_ARGUMENT_1, "-l" };
+static constexpr const char *testExtraArgs[] = { "SmartOptions", POSITIONAL_ARGUMENT_1, POSITIONAL_ARGUMENT_2 };
+static_assert(SMARTOPTIONS_INVALID_ARGUMENT == testDefaultsBinding.Scan(SIZE_OF_ARRAY(testUnknownArgs), testUnknownArgs).status, "");
+static_assert(SMARTOPTIONS_INVALID_ARGUMENT == testDefaultsBinding.Scan(SIZE_OF_ARRAY(testMissingArgs), testMissingArgs).status, "");
+static_assert(SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS == testDefaultsBinding.Scan(SIZE_OF_ARRAY(testExtraArgs), testExtraArgs).status, "");
+
+class ConstexprParseTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testConstexprScan_Apply_Pass(void)
+    {
+        // Arrange
+        TestDefaults defaults = TestDefaults();
+
+        // Act
+        SMARTOPTIONS_STATUS status = testDefaultsBinding.Apply(testDefaultScan, defaults);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(defaults.level, 4);
+        TS_ASSERT(defaults.verbose);
+        TS_ASSERT_SAME_DATA(defaults.option, OPTION_ARGUMENT_1, strlen(OPTION_ARGUMENT_1));
+        TS_ASSERT_SAME_DATA(defaults.name, POSITIONAL_ARGUMENT_1, strlen(POSITIONAL_ARGUMENT_1));
+    }
+
+    void testConstexprScan_Apply_Fail(void)
+    {
+        // Arrange
+        static constexpr const char *argV[] = { "SmartOptions", "-l", "four", POSITIONAL_ARGUMENT_1 };
+        static constexpr SmartOptionsScanResult<SIZE_OF_ARRAY(testDefaultsMembers)> scan = testDefaultsBinding.Scan(SIZE_OF_ARRAY(argV), argV);
+        TestDefaults defaults = TestDefaults();
+
+        // Act
+        SMARTOPTIONS_STATUS status = testDefaultsBinding.Apply(scan, defaults);
+
+        // Assert: the scan succeeds, the conversion happens at run time...
+        TS_ASSERT_EQUALS(scan.status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_FORMAT);
+    }
+};
@@ -0,0 +1,98 @@
+/**
+ * @file        ConverterArgTest.h
+ *
+ * @brief       Test User Defined Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test Option Arguments bound to user defined and integral
+ * types through SmartOptionsConverter.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+struct TestShardKey {
+    uint32_t shard;
+};
+
+template <>
+struct SmartOptionsConverter<TestShardKey> {
+    static SMARTOPTIONS_STATUS parse(std::string_view value, TestShardKey &result) {
+        if (value.substr(0, 6) != "shard-") return SMARTOPTIONS_INVALID_FORMAT;
+        return SmartOptionsConverter<uint32_t>::parse(value.substr(6), result.shard);
+    }
+};
+
+class ConverterArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testCustom_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-kshard-42", "-p", "-17" };
+        TestShardKey shardKey = { 0 };
+        int count = 0;
+
+        // Act
+        smartOptions.AddOption(CUSTOM_PREFIX_SHORT, CUSTOM_PREFIX_LONG, CUSTOM_META, CUSTOM_HELP, &shardKey);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &count);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(shardKey.shard, 42u);
+        TS_ASSERT_EQUALS(count, -17);
+    }
+
+    void testCustom_Format_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-k", "replica-1" };
+        TestShardKey shardKey = { 7 };
+
+        // Act
+        smartOptions.AddOption(CUSTOM_PREFIX_SHORT, CUSTOM_PREFIX_LONG, CUSTOM_META, CUSTOM_HELP, &shardKey);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_FORMAT);
+        TS_ASSERT_EQUALS(shardKey.shard, 7u);
+    }
+
+    void testIntegral_Range_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-p", "256" };
+        uint8_t level = 0;
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &level);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_OUT_OF_RANGE);
+    }
+
+    void testIntegral_Format_Fail(void)
+    {
+        // Arrange
+        const char *invalid[] = { "", "+", "12a", "0x10", "--1", " 1" };
+        long value = 0;
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(invalid); i++) {
+            TS_ASSERT_EQUALS(SmartOptionsConverter<long>::parse(invalid[i], value), SMARTOPTIONS_INVALID_FORMAT);
+        }
+        TS_ASSERT_EQUALS(SmartOptionsConverter<long>::parse("+15", value), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(value, 15);
+    }
+};
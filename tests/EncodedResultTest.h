@@ -0,0 +1,101 @@
+/**
+ * @file        EncodedResultTest.h
+ *
+ * @brief       Test the binary encoding of parse results.
+ *
+ * @details     This file contains a CxxTest test-suite to test encoding a parse result and using it in place
+ * through SmartOptionsResultView in SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class EncodedResultTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testEncodedResult_RoundTrip_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-v", OPTION_ARGUMENT_1_SM, OPTION_ARGUMENT_1_SS "-2" };
+        const char *optionO = NULL;
+        const char *optionP = NULL;
+        bool verbose = false;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        const SmartOptionsResult &result = smartOptions.GetResult();
+
+        // Act: the encoding is copied, as if it was received by another process...
+        std::vector<char> buffer(result.EncodedSize());
+        SMARTOPTIONS_STATUS encodeStatus = result.Encode(buffer.data(), buffer.size());
+        std::vector<char> received(buffer);
+        SmartOptionsResultView view;
+        SMARTOPTIONS_STATUS attachStatus = view.Attach(received.data(), received.size());
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(encodeStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(attachStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(view.OptionCount(), 3);
+        TS_ASSERT_EQUALS(view.BindingCount(), 3);
+        TS_ASSERT(view.IsSet(0));
+        TS_ASSERT(!view.IsSet(1));
+        TS_ASSERT(view.IsSet(2));
+        TS_ASSERT(!view.IsSet(3));
+        TS_ASSERT_EQUALS(std::string(view.Value(0)), OPTION_ARGUMENT_1 "-2");
+        TS_ASSERT_EQUALS(std::string(view.BindingValue(1)), OPTION_ARGUMENT_1);
+        TS_ASSERT_EQUALS(view.BindingId(0), 2);
+        TS_ASSERT(NULL == view.Value(1));
+        TS_ASSERT(NULL == view.Value(2));
+        TS_ASSERT_EQUALS(view.Source(0), SMARTOPTIONS_SOURCE_COMMAND_LINE);
+        TS_ASSERT_EQUALS(view.Source(1), SMARTOPTIONS_SOURCE_DEFAULT);
+    }
+
+    void testEncodedResult_SmallBuffer_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_1_SM };
+        const char *optionO = NULL;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        std::vector<char> buffer(smartOptions.GetResult().EncodedSize());
+
+        // Act
+        SMARTOPTIONS_STATUS status = smartOptions.GetResult().Encode(buffer.data(), buffer.size() - 1);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+
+    void testEncodedResult_Damaged_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_1_SM };
+        const char *optionO = NULL;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        std::vector<char> buffer(smartOptions.GetResult().EncodedSize());
+        smartOptions.GetResult().Encode(buffer.data(), buffer.size());
+        SmartOptionsResultView view;
+
+        // Act & Assert: truncated, wrong magic, and a value offset outside of the blob...
+        TS_ASSERT_EQUALS(view.Attach(buffer.data(), buffer.size() - 1), SMARTOPTIONS_INVALID_FORMAT);
+        buffer[0] ^= 0x20;
+        TS_ASSERT_EQUALS(view.Attach(buffer.data(), buffer.size()), SMARTOPTIONS_INVALID_FORMAT);
+        buffer[0] ^= 0x20;
+        buffer[buffer.size() - strlen(OPTION_ARGUMENT_1) - 1 - 12] = 0x7F;
+        TS_ASSERT_EQUALS(view.Attach(buffer.data(), buffer.size()), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT(NULL == view.Value(0));
+    }
+};
@@ -0,0 +1,143 @@
+/**
+ * @file        EnumArgTest.h
+ *
+ * @brief       Test Enum Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test Enum Option Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+enum TestMode { TEST_MODE_FAST, TEST_MODE_SAFE, TEST_MODE_PARANOID };
+
+static constexpr SmartOptionsChoice<TestMode> testModeChoices[] = {
+    { "fast", TEST_MODE_FAST }, { "safe", TEST_MODE_SAFE }, { "paranoid", TEST_MODE_PARANOID }
+};
+static constexpr SmartOptionsChoices<TestMode, 3> testModes = SmartOptionsMakeChoices(testModeChoices);
+
+static constexpr TestMode LookupTestMode(const char *name) {
+    TestMode mode = TEST_MODE_FAST;
+    return testModes.Lookup(name, mode) ? mode : TEST_MODE_FAST;
+}
+
+// The perfect hash is generated and usable at compile time...
+static_assert(LookupTestMode("paranoid") == TEST_MODE_PARANOID, "constexpr lookup of 'paranoid' failed");
+static_assert(LookupTestMode("safe") == TEST_MODE_SAFE, "constexpr lookup of 'safe' failed");
+
+class EnumArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testEnum_SS_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", ENUM_ARGUMENT_SS };
+        TestMode mode = TEST_MODE_FAST;
+
+        // Act
+        smartOptions.AddEnumOption(ENUM_PREFIX_SHORT, ENUM_PREFIX_LONG, ENUM_META, ENUM_HELP, testModes, &mode);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(mode, TEST_MODE_PARANOID);
+    }
+
+    void testEnum_SM_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", ENUM_ARGUMENT_SM, OPTION_ARGUMENT_1_SS };
+        TestMode mode = TEST_MODE_FAST;
+        const char *optArg_1 = NULL;
+
+        // Act
+        smartOptions.AddEnumOption(ENUM_PREFIX_SHORT, ENUM_PREFIX_LONG, ENUM_META, ENUM_HELP, testModes, &mode);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optArg_1);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(mode, TEST_MODE_SAFE);
+        TS_ASSERT_SAME_DATA(optArg_1, OPTION_ARGUMENT_1, strlen(OPTION_ARGUMENT_1));
+    }
+
+    void testEnum_Default_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions" };
+        TestMode mode = TEST_MODE_SAFE;
+
+        // Act
+        smartOptions.AddEnumOption(ENUM_PREFIX_SHORT, ENUM_PREFIX_LONG, ENUM_META, ENUM_HELP, testModes, &mode);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(mode, TEST_MODE_SAFE);
+    }
+
+    void testEnum_Invalid_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", ENUM_ARGUMENT_INVALID };
+        TestMode mode = TEST_MODE_FAST;
+
+        // Act
+        smartOptions.AddEnumOption(ENUM_PREFIX_SHORT, ENUM_PREFIX_LONG, ENUM_META, ENUM_HELP, testModes, &mode);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(mode, TEST_MODE_FAST);
+    }
+
+    void testEnum_MissingValue_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-m" };
+        TestMode mode = TEST_MODE_FAST;
+
+        // Act
+        smartOptions.AddEnumOption(ENUM_PREFIX_SHORT, ENUM_PREFIX_LONG, ENUM_META, ENUM_HELP, testModes, &mode);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+
+    void testEnum_ManyChoices_Pass(void)
+    {
+        // Arrange
+        static const SmartOptionsChoice<int> choices[] = {
+            { "alpha", 0 }, { "bravo", 1 }, { "charlie", 2 }, { "delta", 3 }, { "echo", 4 },
+            { "foxtrot", 5 }, { "golf", 6 }, { "hotel", 7 }, { "india", 8 }, { "juliett", 9 },
+            { "kilo", 10 }, { "lima", 11 }, { "mike", 12 }, { "november", 13 }, { "oscar", 14 },
+            { "papa", 15 }, { "quebec", 16 }, { "romeo", 17 }, { "sierra", 18 }, { "tango", 19 }
+        };
+        SmartOptionsChoices<int, SIZE_OF_ARRAY(choices)> table(choices);
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(choices); i++) {
+            int value = -1;
+            TS_ASSERT(table.Lookup(choices[i].name, value));
+            TS_ASSERT_EQUALS(value, choices[i].value);
+        }
+        int value = -1;
+        TS_ASSERT(!table.Lookup("zulu", value));
+        TS_ASSERT(!table.Lookup("", value));
+        TS_ASSERT(!table.Lookup("alph", value));
+        TS_ASSERT_EQUALS(value, -1);
+    }
+};
@@ -0,0 +1,95 @@
+/**
+ * @file        ExpandedArgTest.h
+ *
+ * @brief       Test Expanded Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test the lazy expansion of environment variables and '~'
+ * in Option Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class ExpandedArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        setenv("HOME", "/home/tester", 1);
+        setenv("SMARTOPTIONS_DIR", "cache", 1);
+        unsetenv("SMARTOPTIONS_UNSET");
+    }
+
+    void testExpanded_NoMarkers_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-e", "plain/value~" };
+        SmartOptionsExpandedValue value;
+
+        // Act
+        smartOptions.AddExpandedOption(EXPAND_PREFIX_SHORT, EXPAND_PREFIX_LONG, EXPAND_META, EXPAND_HELP, &value);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert: the value is not copied...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(value.Get(), argV[2]);
+    }
+
+    void testExpanded_Variables_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-e~/${SMARTOPTIONS_DIR}/$SMARTOPTIONS_DIR.x$SMARTOPTIONS_UNSET-$$1" };
+        SmartOptionsExpandedValue value;
+        SmartOptionsExpandedValue unused;
+
+        // Act
+        smartOptions.AddExpandedOption(EXPAND_PREFIX_SHORT, EXPAND_PREFIX_LONG, EXPAND_META, EXPAND_HELP, &value);
+        smartOptions.AddExpandedOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &unused);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(std::string(value.Get()), "/home/tester/cache/cache.x-$1");
+        TS_ASSERT_EQUALS(std::string(value.Raw()), std::string(argV[1] + 2));
+        TS_ASSERT(NULL == unused.Get());
+    }
+
+    void testExpanded_Literal_Pass(void)
+    {
+        // Arrange
+        const char *literals[] = { "~user/x", "${UNTERMINATED", "$1", "cost: 5$" };
+        SmartOptionsArena arena;
+        SmartOptionsExpandedValue value;
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(literals); i++) {
+            value.assign(literals[i], &arena);
+            TS_ASSERT_EQUALS(std::string(value.Get()), std::string(literals[i]));
+        }
+    }
+
+    void testExpanded_LongValue_Pass(void)
+    {
+        // Arrange
+        std::string longValue(10000, 'x');
+        SmartOptionsArena arena;
+        SmartOptionsExpandedValue value;
+        setenv("SMARTOPTIONS_DIR", longValue.c_str(), 1);
+
+        // Act: the expanded value is much longer than the raw one...
+        value.assign("$SMARTOPTIONS_DIR/${SMARTOPTIONS_DIR}", &arena);
+        std::string expanded = value.Get();
+
+        // Assert
+        TS_ASSERT_EQUALS(expanded, longValue + "/" + longValue);
+    }
+};
@@ -0,0 +1,121 @@
+/**
+ * @file        FeatureSetArgTest.h
+ *
+ * @brief       Test Feature Set Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test Feature Set Option Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+static constexpr SmartOptionsChoice<unsigned> testFeatureChoices[] = {
+    { "batching", 0 }, { "compression", 1 }, { "prefetch", 2 }, { "tracing", 63 }, { "wide", 100 }
+};
+static constexpr SmartOptionsChoices<unsigned, 5> testFeatures = SmartOptionsMakeChoices(testFeatureChoices);
+
+class FeatureSetArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testFeatureSet_SS_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-fbatching,tracing" };
+        uint64_t features = 0;
+
+        // Act
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, testFeatures, &features);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(features, ((uint64_t)1 << 0) | ((uint64_t)1 << 63));
+    }
+
+    void testFeatureSet_Repeated_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-f", "compression,-batching", "-f", "prefetch,-compression" };
+        uint64_t features = (1 << 0);   // Default set...
+
+        // Act
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, testFeatures, &features);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(features, (uint64_t)(1 << 2));
+    }
+
+    void testFeatureSet_Unknown_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-f", "batching,turbo" };
+        uint64_t features = 0;
+
+        // Act
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, testFeatures, &features);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(features, (uint64_t)0);
+    }
+
+    void testFeatureSet_Empty_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-f", "batching,,prefetch" };
+        uint64_t features = 0;
+
+        // Act
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, testFeatures, &features);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+
+    void testFeatureSet_WideMask_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-f", "wide,tracing,-tracing" };
+        std::bitset<128> features;
+
+        // Act
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, testFeatures, &features);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT(features.test(100));
+        TS_ASSERT_EQUALS(features.count(), (size_t)1);
+    }
+
+    void testFeatureSet_NarrowMask_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-f", "wide" };
+        uint64_t features = 0;
+
+        // Act
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, testFeatures, &features);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+};
@@ -0,0 +1,99 @@
+/**
+ * @file        FileArgTest.h
+ *
+ * @brief       Test File backed Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test File backed Option Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include <stdio.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class FileArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        std::ofstream file(FILE_PATH, std::ios::out | std::ios::binary);
+        file << FILE_CONTENT;
+    }
+
+    void tearDown()
+    {
+        remove(FILE_PATH);
+    }
+
+    void testFile_Path_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-q", FILE_PATH };
+        SmartOptionsFileValue query;
+        std::string_view view;
+
+        // Act
+        smartOptions.AddFileOption(FILE_PREFIX_SHORT, FILE_PREFIX_LONG, FILE_META, FILE_HELP, &query, false);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT(query.IsSet());
+        TS_ASSERT_EQUALS(query.View(view), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(view, std::string_view(FILE_CONTENT));
+    }
+
+    void testFile_AtPath_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-q@" FILE_PATH, "-p", "inline value" };
+        SmartOptionsFileValue query;
+        SmartOptionsFileValue other;
+        std::string_view view;
+
+        // Act
+        smartOptions.AddFileOption(FILE_PREFIX_SHORT, FILE_PREFIX_LONG, FILE_META, FILE_HELP, &query, true);
+        smartOptions.AddFileOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &other, true);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(query.View(view), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(view, std::string_view(FILE_CONTENT));
+        TS_ASSERT(NULL == other.Path());
+        TS_ASSERT_EQUALS(other.View(view), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(view, std::string_view("inline value"));
+    }
+
+    void testFile_Lazy_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-q", "does/not/exist" };
+        SmartOptionsFileValue query;
+        SmartOptionsFileValue unused;
+        std::string_view view;
+
+        // Act
+        smartOptions.AddFileOption(FILE_PREFIX_SHORT, FILE_PREFIX_LONG, FILE_META, FILE_HELP, &query, false);
+        smartOptions.AddFileOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &unused, false);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert: the missing file is only noticed when the value is accessed...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(query.View(view), SMARTOPTIONS_SYSTEM_ERROR);
+        TS_ASSERT_EQUALS(errno, ENOENT);
+        TS_ASSERT(!unused.IsSet());
+        TS_ASSERT_EQUALS(unused.View(view), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT(view.empty());
+    }
+};
@@ -0,0 +1,125 @@
+/**
+ * @file        FingerprintTest.h
+ *
+ * @brief       Test the fingerprint of the effective configuration.
+ *
+ * @details     This file contains a CxxTest test-suite to test the fingerprints of parse results in SmartOptions
+ * library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+static constexpr SmartOptionsChoice<unsigned> fingerprintFeatureChoices[] = { { "sse", 0 }, { "avx", 1 } };
+static constexpr SmartOptionsChoices<unsigned, 2> fingerprintFeatures = SmartOptionsMakeChoices(fingerprintFeatureChoices);
+
+class FingerprintTestSuite : public CxxTest::TestSuite
+{
+public:
+    /**
+     * @brief Processes a command line with two options, a flag, a feature set, a double and an address, and returns
+     * the fingerprint.
+     *
+     * @param defaultFeatures The default of the feature set.
+     */
+    template <size_t N>
+    static uint64_t fingerprintOf(const char *(&argV)[N], uint64_t defaultFeatures = 0)
+    {
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *optionO = NULL;
+        const char *optionP = NULL;
+        bool verbose = false;
+        uint64_t features = 0;
+        double ratio = 0.0;
+        SmartOptionsIPAddress address;
+        SmartOptionsResult firstResult;
+        SmartOptionsResult result;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, fingerprintFeatures, &features);
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        smartOptions.AddAddressOption(NET_PREFIX_SHORT, NET_PREFIX_LONG, NET_META, NET_HELP, &address);
+        features = defaultFeatures;
+        // Parse() converts into scratch values, before and after the defaults are saved, and gets the same fingerprint...
+        TS_ASSERT_EQUALS(smartOptions.Parse(N, argV, firstResult), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(smartOptions.ProcessCommandArgs(N, argV), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(smartOptions.Parse(N, argV, result), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(firstResult.Fingerprint(), smartOptions.GetResult().Fingerprint());
+        TS_ASSERT_EQUALS(result.Fingerprint(), smartOptions.GetResult().Fingerprint());
+        return smartOptions.GetResult().Fingerprint();
+    }
+
+    void testFingerprint_OrderAndOverrides_Pass(void)
+    {
+        // Arrange
+        const char *argV1[] = { "SmartOptions", "-v", OPTION_ARGUMENT_1_SM, OPTION_ARGUMENT_2_SS };
+        const char *argV2[] = { "SmartOptions", OPTION_ARGUMENT_2_SM, "-oold", "-v", OPTION_ARGUMENT_1_SS, "-v" };
+
+        // Act & Assert: the order, overridden values and repeated flags do not count...
+        TS_ASSERT_EQUALS(fingerprintOf(argV1), fingerprintOf(argV2));
+    }
+
+    void testFingerprint_EquivalentSpellings_Pass(void)
+    {
+        // Arrange
+        const char *ratio1[] = { "SmartOptions", "-r1.0" };
+        const char *ratio2[] = { "SmartOptions", "-r", "1.00" };
+        const char *address1[] = { "SmartOptions", "-n::1" };
+        const char *address2[] = { "SmartOptions", "-n0:0:0:0:0:0:0:1" };
+        const char *features1[] = { "SmartOptions", "-fsse,avx" };
+        const char *features2[] = { "SmartOptions", "-fsse", "-favx" };
+        const char *features3[] = { "SmartOptions", "-favx", "-fsse,-avx", "-favx" };
+
+        // Act & Assert: the values are compared once converted...
+        TS_ASSERT_EQUALS(fingerprintOf(ratio1), fingerprintOf(ratio2));
+        TS_ASSERT_EQUALS(fingerprintOf(address1), fingerprintOf(address2));
+        TS_ASSERT_EQUALS(fingerprintOf(features1), fingerprintOf(features2));
+        TS_ASSERT_EQUALS(fingerprintOf(features1), fingerprintOf(features3));
+    }
+
+    void testFingerprint_Differences_Pass(void)
+    {
+        // Arrange
+        const char *argV1[] = { "SmartOptions", OPTION_ARGUMENT_1_SM };
+        const char *argV2[] = { "SmartOptions", OPTION_ARGUMENT_1_SS "-2" };
+        const char *argV3[] = { "SmartOptions", "-p" OPTION_ARGUMENT_1 };
+        const char *argV4[] = { "SmartOptions" };
+        const char *argV5[] = { "SmartOptions", "-fsse", "-f-sse" };
+        const char *argV6[] = { "SmartOptions", "-f-sse", "-fsse" };
+        const char *argV7[] = { "SmartOptions", "-r1.5" };
+        const char *argV8[] = { "SmartOptions", "-r1.0" };
+
+        // Act & Assert: the values, the options, and the order of the enabled and disabled features count...
+        TS_ASSERT_DIFFERS(fingerprintOf(argV1), fingerprintOf(argV2));
+        TS_ASSERT_DIFFERS(fingerprintOf(argV1), fingerprintOf(argV3));
+        TS_ASSERT_DIFFERS(fingerprintOf(argV1), fingerprintOf(argV4));
+        TS_ASSERT_DIFFERS(fingerprintOf(argV5), fingerprintOf(argV6));
+        TS_ASSERT_DIFFERS(fingerprintOf(argV7), fingerprintOf(argV8));
+    }
+
+    void testFingerprint_RepeatableDefault_Pass(void)
+    {
+        // Arrange
+        const char *argV1[] = { "SmartOptions", "-fsse,-sse" };
+        const char *argV2[] = { "SmartOptions", "-favx,-avx" };
+        const char *argV3[] = { "SmartOptions", "-f", "sse", "-f", "-sse" };
+        const char *argV4[] = { "SmartOptions", "-f", "avx", "-f", "-avx" };
+        const char *argV5[] = { "SmartOptions", "-f-sse" };
+        const uint64_t defaultFeatures = (1 << 0) | (1 << 1);
+
+        // Act & Assert: the features accumulate into the default, so disabling different features counts...
+        TS_ASSERT_DIFFERS(fingerprintOf(argV1, defaultFeatures), fingerprintOf(argV2, defaultFeatures));
+        TS_ASSERT_DIFFERS(fingerprintOf(argV3, defaultFeatures), fingerprintOf(argV4, defaultFeatures));
+        TS_ASSERT_EQUALS(fingerprintOf(argV1, defaultFeatures), fingerprintOf(argV3, defaultFeatures));
+        TS_ASSERT_EQUALS(fingerprintOf(argV1, defaultFeatures), fingerprintOf(argV5, defaultFeatures));
+        TS_ASSERT_DIFFERS(fingerprintOf(argV5, defaultFeatures), fingerprintOf(argV5));
+    }
+};
@@ -0,0 +1,109 @@
+/**
+ * @file        FloatArgTest.h
+ *
+ * @brief       Test Floating Point Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test float and double Option Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include <clocale>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class FloatArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testDouble_SS_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-r0.1" };
+        double ratio = 0;
+
+        // Act
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(ratio, 0.1);   // Correctly rounded...
+    }
+
+    void testFloat_SM_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-r", "+2.5e-3" };
+        float ratio = 0;
+
+        // Act
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(ratio, 2.5e-3f);
+    }
+
+    void testDouble_Locale_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-r", "-1.25" };
+        double ratio = 0;
+        std::string savedLocale = setlocale(LC_NUMERIC, NULL);
+        setlocale(LC_NUMERIC, "de_DE.UTF-8");   // Uses ',' as decimal separator, if installed...
+
+        // Act
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        setlocale(LC_NUMERIC, savedLocale.c_str());
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(ratio, -1.25);
+    }
+
+    void testDouble_Format_Fail(void)
+    {
+        // Arrange
+        const char *invalid[] = { "", "1.5x", "abc", "1,5", "+-1", " 1" };
+
+        for (size_t i = 0; i < SIZE_OF_ARRAY(invalid); i++) {
+            SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+            const char *argV[] = { "SmartOptions", "-r", invalid[i] };
+            double ratio = 7;
+
+            // Act
+            smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+            SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+            // Assert
+            TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_FORMAT);
+            TS_ASSERT_EQUALS(ratio, 7);
+        }
+    }
+
+    void testFloat_Range_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-r", "1e39" };
+        float ratio = 0;
+
+        // Act
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_OUT_OF_RANGE);
+    }
+};
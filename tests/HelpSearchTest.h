@@ -0,0 +1,71 @@
+/**
+ * @file        HelpSearchTest.h
+ *
+ * @brief       Test the keyword search over the help text.
+ *
+ * @details     This file contains a CxxTest test-suite to test the help search of the SmartOptions library, with
+ * and without the trigram index.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class HelpSearchTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testHelpSearch_Keyword_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *optionO = NULL;
+        const char *optionP = NULL;
+        double ratio = 0.0;
+        bool verbose = false;
+        const char *keywords[] = { "argument", "RATIO", "flag in json", "p", "io", "missing", "" };
+        std::vector<unsigned> expectedIds[] = { { 0, 1 }, { 2 }, { 3 }, { 1 }, { 0, 1, 2 }, {}, { 0, 1, 2, 3 } };
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+
+        // Assert: the index finds the same options as the scan...
+        for (size_t index = 0; index < SIZE_OF_ARRAY(keywords); index++) {
+            std::vector<unsigned> ids;
+            smartOptions.SearchHelp(keywords[index], ids);
+            TS_ASSERT_EQUALS(ids, expectedIds[index]);
+        }
+        smartOptions.BuildHelpIndex();
+        for (size_t index = 0; index < SIZE_OF_ARRAY(keywords); index++) {
+            std::vector<unsigned> ids;
+            smartOptions.SearchHelp(keywords[index], ids);
+            TS_ASSERT_EQUALS(ids, expectedIds[index]);
+        }
+    }
+
+    void testHelpSearch_OptionAddedAfterIndex_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *optionO = NULL;
+        bool verbose = false;
+        std::vector<unsigned> ids;
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.BuildHelpIndex();
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.SearchHelp(JSON_FLAG_LONG, ids);
+
+        // Assert: adding an option drops the index, so the new option is still found...
+        TS_ASSERT_EQUALS(ids, std::vector<unsigned>({ 1 }));
+    }
+};
@@ -0,0 +1,65 @@
+/**
+ * @file        HelpTextTest.h
+ *
+ * @brief       Test the help text, kept apart from the option records.
+ *
+ * @details     This file contains a CxxTest test-suite to test the help text table of the SmartOptions library,
+ * which is indexed by the option ID and only read by the help and the error messages.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class HelpTextTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testHelpText_IndexedById_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *optionO = NULL;
+        double ratio = 0.0;
+        bool verbose = false;
+        const char *positional = NULL;
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_2, &positional);
+
+        // Assert
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(0).metaVariable), OPT_META_1);
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(0).helpString), OPT_HELP_1);
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(1).metaVariable), FLOAT_META);
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(1).helpString), FLOAT_HELP);
+        TS_ASSERT(NULL == smartOptions.GetHelpText(2).metaVariable);
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(2).helpString), JSON_FLAG_HELP);
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(3).metaVariable), POSITIONAL_ARGUMENT_1);
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(3).helpString), OPT_HELP_2);
+    }
+
+    void testHelpText_PositionalName_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", POSITIONAL_ARGUMENT_1 };
+        const char *positional = NULL;
+
+        // Act
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert: the positional argument is still named after its meta variable...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(smartOptions.ToJson(), std::string("{\"program\":\"SmartOptionsTest\",\"options\":["
+                "{\"id\":0,\"kind\":\"positional\",\"name\":\"PositionArgument-1\",\"source\":\"command-line\",\"values\":[\"PositionArgument-1\"]}]}"));
+    }
+};
@@ -0,0 +1,266 @@
+/**
+ * @file        IncrementalParseTest.h
+ *
+ * @brief       Test the incremental processing of edited command lines.
+ *
+ * @details     This file contains a CxxTest test-suite to test ProcessCommandArgsEdit() of SmartOptions library,
+ * by comparing it with processing the edited command line from scratch.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+static constexpr SmartOptionsChoice<unsigned> incrementalFeatureChoices[] = { { "sse", 0 }, { "avx", 1 } };
+static constexpr SmartOptionsChoices<unsigned, 2> incrementalFeatures = SmartOptionsMakeChoices(incrementalFeatureChoices);
+
+/**
+ * @brief The options used by the tests, two string options, a flag, a double and a positional argument.
+ */
+struct IncrementalOptions {
+    SmartOptions smartOptions;
+    const char *optionO;
+    const char *optionP;
+    const char *positional;
+    bool verbose;
+    double ratio;
+
+    IncrementalOptions() : smartOptions("SmartOptionsTest", false), positional(NULL), ratio(0.0) {
+        this->smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &this->optionO);
+        this->smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &this->optionP);
+        this->smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &this->verbose);
+        this->smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &this->ratio);
+        this->smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &this->positional);
+    }
+};
+
+class IncrementalParseTestSuite : public CxxTest::TestSuite
+{
+public:
+    /**
+     * @brief Applies an edit incrementally, and compares the outcome with processing the edited command line from scratch.
+     */
+    void checkEdit(std::vector<const char *> argV, SMARTOPTIONS_EDIT edit, int index, const char *token, SMARTOPTIONS_STATUS expected)
+    {
+        IncrementalOptions incremental;
+        TS_ASSERT_EQUALS(incremental.smartOptions.ProcessCommandArgs((int)argV.size(), argV.data()), SMARTOPTIONS_SUCCESS);
+
+        if (SMARTOPTIONS_EDIT_INSERT == edit) argV.insert(argV.begin() + index, token);
+        if (SMARTOPTIONS_EDIT_REPLACE == edit) argV[index] = token;
+        if (SMARTOPTIONS_EDIT_DELETE == edit) argV.erase(argV.begin() + index);
+
+        SMARTOPTIONS_STATUS status = incremental.smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), edit, index);
+        TS_ASSERT_EQUALS(status, expected);
+        checkSame(incremental, argV, expected);
+    }
+
+    /**
+     * @brief Compares the outcome of the edits applied so far with processing the command line from scratch.
+     */
+    void checkSame(const IncrementalOptions &incremental, std::vector<const char *> argV, SMARTOPTIONS_STATUS expected)
+    {
+        IncrementalOptions scratch;
+        TS_ASSERT_EQUALS(scratch.smartOptions.ProcessCommandArgs((int)argV.size(), argV.data()), expected);
+        if (SMARTOPTIONS_SUCCESS != expected) return;
+
+        const SmartOptionsResult &result = incremental.smartOptions.GetResult();
+        const SmartOptionsResult &expectedResult = scratch.smartOptions.GetResult();
+        TS_ASSERT_EQUALS(result.Fingerprint(), expectedResult.Fingerprint());
+        TS_ASSERT_EQUALS(result.BindingCount(), expectedResult.BindingCount());
+        for (size_t index = 0; index < result.BindingCount() && index < expectedResult.BindingCount(); index++) {
+            TS_ASSERT_EQUALS(result.Binding(index).id, expectedResult.Binding(index).id);
+            TS_ASSERT_EQUALS(result.ParameterIndex(&result.Binding(index)), expectedResult.ParameterIndex(&expectedResult.Binding(index)));
+            TS_ASSERT_EQUALS(result.Binding(index).value, expectedResult.Binding(index).value);
+        }
+        for (unsigned id = 0; id < result.OptionCount(); id++) {
+            TS_ASSERT_EQUALS(result.Value(id), expectedResult.Value(id));
+        }
+        std::vector<char> encoded(result.EncodedSize());
+        std::vector<char> expectedEncoded(expectedResult.EncodedSize());
+        TS_ASSERT_EQUALS(result.Encode(encoded.data(), encoded.size()), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(expectedResult.Encode(expectedEncoded.data(), expectedEncoded.size()), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT(encoded == expectedEncoded);
+        TS_ASSERT_EQUALS(incremental.optionO, scratch.optionO);
+        TS_ASSERT_EQUALS(incremental.optionP, scratch.optionP);
+        TS_ASSERT_EQUALS(incremental.verbose, scratch.verbose);
+        TS_ASSERT_EQUALS(incremental.ratio, scratch.ratio);
+        TS_ASSERT_EQUALS(incremental.positional, scratch.positional);
+    }
+
+    void testIncrementalParse_Insert_Pass(void)
+    {
+        std::vector<const char *> argV = { "SmartOptions", OPTION_ARGUMENT_1_SM, POSITIONAL_ARGUMENT_1, "-r", "0.5" };
+
+        checkEdit(argV, SMARTOPTIONS_EDIT_INSERT, 1, "-v", SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_INSERT, 6, "-p" OPTION_ARGUMENT_2, SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_INSERT, 4, "-v", SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_INSERT, 4, POSITIONAL_ARGUMENT_2, SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS);
+        // Between an option and its value, the option takes the inserted parameter...
+        checkEdit(argV, SMARTOPTIONS_EDIT_INSERT, 2, "-v", SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_INSERT, 5, "-v", SMARTOPTIONS_INVALID_FORMAT);
+    }
+
+    void testIncrementalParse_Replace_Pass(void)
+    {
+        std::vector<const char *> argV = { "SmartOptions", OPTION_ARGUMENT_1_SM, "-v", POSITIONAL_ARGUMENT_1, "-r", "0.5", OPTION_ARGUMENT_1_SS };
+
+        checkEdit(argV, SMARTOPTIONS_EDIT_REPLACE, 2, OPTION_ARGUMENT_2, SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_REPLACE, 6, "0.25", SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_REPLACE, 7, "-p" OPTION_ARGUMENT_2, SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_REPLACE, 4, POSITIONAL_ARGUMENT_2, SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_REPLACE, 6, "half", SMARTOPTIONS_INVALID_FORMAT);
+        checkEdit(argV, SMARTOPTIONS_EDIT_REPLACE, 3, "-x", SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+
+    void testIncrementalParse_Delete_Pass(void)
+    {
+        std::vector<const char *> argV = { "SmartOptions", "-v", OPTION_ARGUMENT_1_SM, POSITIONAL_ARGUMENT_1, "-r0.5", OPTION_ARGUMENT_1_SS "-2" };
+
+        checkEdit(argV, SMARTOPTIONS_EDIT_DELETE, 1, NULL, SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_DELETE, 6, NULL, SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_DELETE, 5, NULL, SMARTOPTIONS_SUCCESS);
+        checkEdit(argV, SMARTOPTIONS_EDIT_DELETE, 4, NULL, SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS);
+        // The value of the option is deleted, the option takes the positional argument instead...
+        checkEdit(argV, SMARTOPTIONS_EDIT_DELETE, 3, NULL, SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS);
+    }
+
+    void testIncrementalParse_EditSequence_Pass(void)
+    {
+        // Arrange
+        static const char *const tokens[] = { "-v", "-oone", "-ptwo", "-r0.5", "-othree", "-pfour" };
+        IncrementalOptions incremental;
+        std::vector<const char *> argV = { "SmartOptions", POSITIONAL_ARGUMENT_1 };
+        TS_ASSERT_EQUALS(incremental.smartOptions.ProcessCommandArgs((int)argV.size(), argV.data()), SMARTOPTIONS_SUCCESS);
+
+        // Act & Assert: insert, replace and delete back and forth, so that the bindings are moved both ways and
+        // the store grows in the middle...
+        for (size_t step = 0; step < 120; step++) {
+            int index = 1 + (int)((step * 7) % argV.size());
+            SMARTOPTIONS_EDIT edit = (step < 60 || 0 == step % 3) ? SMARTOPTIONS_EDIT_INSERT : (1 == step % 3) ? SMARTOPTIONS_EDIT_REPLACE : SMARTOPTIONS_EDIT_DELETE;
+            if (SMARTOPTIONS_EDIT_INSERT != edit && (index >= (int)argV.size() || argV[index] == std::string(POSITIONAL_ARGUMENT_1))) continue;
+            if (SMARTOPTIONS_EDIT_INSERT == edit) argV.insert(argV.begin() + index, tokens[step % 6]);
+            if (SMARTOPTIONS_EDIT_REPLACE == edit) argV[index] = tokens[(step + 1) % 6];
+            if (SMARTOPTIONS_EDIT_DELETE == edit) argV.erase(argV.begin() + index);
+
+            TS_ASSERT_EQUALS(incremental.smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), edit, index), SMARTOPTIONS_SUCCESS);
+            checkSame(incremental, argV, SMARTOPTIONS_SUCCESS);
+        }
+    }
+
+    void testIncrementalParse_DeleteRepeatable_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        std::vector<const char *> argV = { "SmartOptions", "-fsse", "-n10.0.0.0/8", "-n192.168.0.0/16", "-favx", "-r0.5" };
+        uint64_t features = 0;
+        SmartOptionsIPPrefixTable allowList;
+        double ratio = 1.0;
+        SmartOptionsIPAddress address;
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, incrementalFeatures, &features);
+        smartOptions.AddPrefixOption(NET_PREFIX_SHORT, NET_PREFIX_LONG, NET_META, NET_HELP, &allowList);
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        TS_ASSERT_EQUALS(smartOptions.ProcessCommandArgs((int)argV.size(), argV.data()), SMARTOPTIONS_SUCCESS);
+
+        // Act: delete a feature, then a prefix, then the double...
+        argV.erase(argV.begin() + 1);
+        SMARTOPTIONS_STATUS featureStatus = smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), SMARTOPTIONS_EDIT_DELETE, 1);
+        uint64_t featuresAfterDelete = features;
+        argV.erase(argV.begin() + 1);
+        SMARTOPTIONS_STATUS prefixStatus = smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), SMARTOPTIONS_EDIT_DELETE, 1);
+        size_t prefixCount = allowList.Prefixes().size();
+        bool isDeletedPrefixAllowed = SmartOptionsIPAddress::Parse("10.0.0.1", 8, address) && allowList.Contains(address);
+        argV.pop_back();
+        SMARTOPTIONS_STATUS ratioStatus = smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), SMARTOPTIONS_EDIT_DELETE, 3);
+
+        // Assert: the variables get back the values they had before the first command line...
+        TS_ASSERT_EQUALS(featureStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(featuresAfterDelete, (uint64_t)(1 << 1));
+        TS_ASSERT_EQUALS(prefixStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(prefixCount, (size_t)1);
+        TS_ASSERT(false == isDeletedPrefixAllowed);
+        TS_ASSERT_EQUALS(ratioStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(ratio, 1.0);
+        TS_ASSERT_EQUALS(features, (uint64_t)(1 << 1));
+    }
+
+    void testIncrementalParse_DeleteDefaults_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        std::vector<const char *> argV = { "SmartOptions", "-oout.txt", "-v", "-i" PATH_FILE, "-q" FILE_PATH, "-r2" };
+        const char *output = NULL;
+        bool verbose = false;
+        const char *path = NULL;
+        SmartOptionsFileValue query;
+        double ratio = 1.0;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &output);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddPathOption(PATH_PREFIX_SHORT, PATH_PREFIX_LONG, PATH_META, PATH_HELP, 0, &path);
+        smartOptions.AddFileOption(FILE_PREFIX_SHORT, FILE_PREFIX_LONG, FILE_META, FILE_HELP, &query, false);
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        // The defaults are set once the options are added, which clear their variables...
+        output = "default.txt";
+        verbose = true;
+        path = "default";
+        TS_ASSERT_EQUALS(smartOptions.ProcessCommandArgs((int)argV.size(), argV.data()), SMARTOPTIONS_SUCCESS);
+
+        // Act: delete every option but the double, one by one...
+        SMARTOPTIONS_STATUS status = SMARTOPTIONS_SUCCESS;
+        for (int count = 0; count < 4 && SMARTOPTIONS_SUCCESS == status; count++) {
+            argV.erase(argV.begin() + 1);
+            status = smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), SMARTOPTIONS_EDIT_DELETE, 1);
+        }
+
+        // Assert: the variables get back the values they had before the first command line, whatever their kind...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(std::string((NULL != output) ? output : "(null)"), "default.txt");
+        TS_ASSERT_EQUALS(verbose, true);
+        TS_ASSERT_EQUALS(std::string((NULL != path) ? path : "(null)"), "default");
+        TS_ASSERT_EQUALS(query.IsSet(), false);
+        TS_ASSERT_EQUALS(ratio, 2.0);
+    }
+
+    void testIncrementalParse_ReplaceWithRepeatable_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        std::vector<const char *> argV = { "SmartOptions", "-oout.txt", "-fsse" };
+        const char *output = NULL;
+        uint64_t features = 0;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &output);
+        smartOptions.AddFeatureSetOption(FEATURE_PREFIX_SHORT, FEATURE_PREFIX_LONG, FEATURE_META, FEATURE_HELP, incrementalFeatures, &features);
+        output = "default.txt";
+        TS_ASSERT_EQUALS(smartOptions.ProcessCommandArgs((int)argV.size(), argV.data()), SMARTOPTIONS_SUCCESS);
+
+        // Act: a repeatable option is touched, the command line is processed again from scratch...
+        argV[1] = "-favx";
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), SMARTOPTIONS_EDIT_REPLACE, 1);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(std::string((NULL != output) ? output : "(null)"), "default.txt");
+        TS_ASSERT_EQUALS(features, (uint64_t)((1 << 0) | (1 << 1)));
+    }
+
+    void testIncrementalParse_AfterFailure_Pass(void)
+    {
+        // Arrange
+        IncrementalOptions incremental;
+        std::vector<const char *> argV = { "SmartOptions", "-x" };
+        TS_ASSERT_EQUALS(incremental.smartOptions.ProcessCommandArgs((int)argV.size(), argV.data()), SMARTOPTIONS_INVALID_ARGUMENT);
+
+        // Act: the rejected command line is processed again from scratch...
+        argV[1] = POSITIONAL_ARGUMENT_1;
+        SMARTOPTIONS_STATUS status = incremental.smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), SMARTOPTIONS_EDIT_REPLACE, 1);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(incremental.positional, argV[1]);
+    }
+};
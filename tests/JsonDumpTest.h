@@ -0,0 +1,94 @@
+/**
+ * @file        JsonDumpTest.h
+ *
+ * @brief       Test the JSON dump of the effective configuration.
+ *
+ * @details     This file contains a CxxTest test-suite to test the option IDs, the parse result and its JSON
+ * rendering in SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class JsonDumpTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testJsonDump_Result_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-v", OPTION_ARGUMENT_1_SM, POSITIONAL_ARGUMENT_1 };
+        const char *optionO = NULL;
+        const char *optionP = NULL;
+        const char *positional = NULL;
+        bool verbose = false;
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        const SmartOptionsResult &result = smartOptions.GetResult();
+
+        // Assert: IDs are assigned in the order in which the options are added...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(smartOptions.OptionCount(), 4);
+        TS_ASSERT_EQUALS(smartOptions.FindOption(OPT_PREFIX_SHORT_2), 1);
+        TS_ASSERT_EQUALS(smartOptions.FindOption(JSON_FLAG_LONG), 2);
+        TS_ASSERT_EQUALS(smartOptions.FindOption('z'), SmartOptions::INVALID_OPTION_ID);
+        TS_ASSERT(result.IsSet(0));
+        TS_ASSERT(!result.IsSet(1));
+        TS_ASSERT_EQUALS(result.Value(0), argV[3]);
+        TS_ASSERT_EQUALS(result.Source(1), SMARTOPTIONS_SOURCE_DEFAULT);
+        TS_ASSERT_EQUALS(result.Source(3), SMARTOPTIONS_SOURCE_COMMAND_LINE);
+        TS_ASSERT_EQUALS(smartOptions.ToJson(), std::string("{\"program\":\"SmartOptionsTest\",\"options\":["
+                "{\"id\":0,\"kind\":\"option\",\"short\":\"o\",\"long\":\"optionO\",\"source\":\"command-line\",\"values\":[\"OptionArgument-O\"]},"
+                "{\"id\":1,\"kind\":\"option\",\"short\":\"p\",\"long\":\"optionP\",\"source\":\"default\",\"values\":[]},"
+                "{\"id\":2,\"kind\":\"flag\",\"short\":\"v\",\"long\":\"verbose\",\"source\":\"command-line\",\"value\":true},"
+                "{\"id\":3,\"kind\":\"positional\",\"name\":\"PositionArgument-1\",\"source\":\"command-line\",\"values\":[\"PositionArgument-1\"]}]}"));
+    }
+
+    void testJsonDump_RepeatedValues_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-a10.0.0.0/8", "-a", "192.168.0.0/16" };
+        SmartOptionsIPPrefixTable table;
+
+        // Act
+        smartOptions.AddPrefixOption('a', "allow", "PREFIX", "Allowed prefixes", &table);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert: all the values are kept, in command line order...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(smartOptions.GetResult().BindingCount(), 2);
+        TS_ASSERT_EQUALS(smartOptions.GetResult().Value(0), argV[3]);
+        TS_ASSERT_EQUALS(smartOptions.ToJson(), std::string("{\"program\":\"SmartOptionsTest\",\"options\":["
+                "{\"id\":0,\"kind\":\"value\",\"short\":\"a\",\"long\":\"allow\",\"source\":\"command-line\",\"values\":[\"10.0.0.0/8\",\"192.168.0.0/16\"]}]}"));
+    }
+
+    void testJsonDump_Escaping_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-o", "say \"hi\"\\\n\t\x01" };
+        const char *optionO = NULL;
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, NULL, OPT_META_1, OPT_HELP_1, &optionO);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(smartOptions.ToJson(), std::string("{\"program\":\"SmartOptionsTest\",\"options\":["
+                "{\"id\":0,\"kind\":\"option\",\"short\":\"o\",\"long\":null,\"source\":\"command-line\",\"values\":[\"say \\\"hi\\\"\\\\\\n\\t\\u0001\"]}]}"));
+    }
+};
@@ -0,0 +1,68 @@
+/**
+ * @file        MemoryFootprintTest.h
+ *
+ * @brief       Test the memory footprint of the options and of the parse results.
+ *
+ * @details     This file contains a CxxTest test-suite to test the memory introspection of the SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class MemoryFootprintTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testMemoryFootprint_Spec_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *optionO = NULL;
+        bool verbose = false;
+        SmartOptionsMemoryFootprint empty = smartOptions.MemoryFootprint();
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        SmartOptionsMemoryFootprint added = smartOptions.MemoryFootprint();
+        smartOptions.BuildHelpIndex();
+        SmartOptionsMemoryFootprint indexed = smartOptions.MemoryFootprint();
+
+        // Assert: the referenced strings are counted with their terminators...
+        TS_ASSERT_EQUALS(empty.names, 0);
+        TS_ASSERT_EQUALS(empty.help, 0);
+        TS_ASSERT_EQUALS(added.names, sizeof(OPT_PREFIX_LONG_1) + sizeof(JSON_FLAG_LONG));
+        TS_ASSERT(added.help >= sizeof(OPT_META_1) + sizeof(OPT_HELP_1) + sizeof(JSON_FLAG_HELP) + 2 * sizeof(SmartOptionsHelpText));
+        TS_ASSERT(added.records > empty.records);
+        TS_ASSERT_EQUALS(indexed.records, added.records);
+        TS_ASSERT(indexed.indexes > added.indexes);
+        TS_ASSERT_EQUALS(indexed.Total(), indexed.records + indexed.names + indexed.indexes + indexed.help + indexed.arena + indexed.result);
+    }
+
+    void testMemoryFootprint_Result_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-v", OPTION_ARGUMENT_1_SM };
+        const char *optionO = NULL;
+        bool verbose = false;
+        SmartOptionsResult result;
+        size_t emptySize = result.MemoryFootprint();
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        SMARTOPTIONS_STATUS status = smartOptions.Parse(SIZE_OF_ARRAY(argV), argV, result);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(emptySize, sizeof(SmartOptionsResult));
+        TS_ASSERT(result.MemoryFootprint() >= sizeof(SmartOptionsResult) + 2 * sizeof(SmartOptionsBinding));
+    }
+};
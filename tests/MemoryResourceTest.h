@@ -0,0 +1,102 @@
+/**
+ * @file        MemoryResourceTest.h
+ *
+ * @brief       Test the options allocated from a caller supplied memory resource.
+ *
+ * @details     This file contains a CxxTest test-suite to test the std::pmr::memory_resource support of the
+ * SmartOptions library, and the reporting of allocation failures.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+/**
+ * @brief A memory resource, which counts the bytes allocated from it.
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocated = 0;   //!< @brief The number of bytes currently allocated.
+
+private:
+    void *do_allocate(size_t bytes, size_t alignment) override {
+        this->allocated += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+        this->allocated -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+class MemoryResourceTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testMemoryResource_Allocations_Pass(void)
+    {
+        // Arrange
+        CountingResource resource;
+        const char *argV[] = { "SmartOptions", "-v", OPTION_ARGUMENT_1_SM, POSITIONAL_ARGUMENT_1 };
+        const char *optionO = NULL;
+        bool verbose = false;
+        const char *positional = NULL;
+        size_t addedBytes = 0;
+        size_t processedBytes = 0;
+        SMARTOPTIONS_STATUS status = SMARTOPTIONS_SUCCESS;
+
+        // Act
+        {
+            SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false, &resource);
+            smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+            smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+            smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+            addedBytes = resource.allocated;
+            status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+            processedBytes = resource.allocated;
+        }
+
+        // Assert: the options and the result come from the resource, and are all given back...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(std::string(optionO), OPTION_ARGUMENT_1);
+        TS_ASSERT(verbose);
+        TS_ASSERT(addedBytes > 0);
+        TS_ASSERT(processedBytes > addedBytes);
+        TS_ASSERT_EQUALS(resource.allocated, 0);
+    }
+
+    void testMemoryResource_Exhausted_Fail(void)
+    {
+        // Arrange
+        char buffer[256];
+        std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+        const char *argV[] = { "SmartOptions", "-v" };
+        bool verbose = false;
+        SmartOptionsResult result;
+
+        // Act
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false, &resource);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        errno = 0;
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        int error = errno;
+        SMARTOPTIONS_STATUS parseStatus = smartOptions.Parse(SIZE_OF_ARRAY(argV), argV, result);
+
+        // Assert: the option which could not be added is dropped, and the failure is reported...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SYSTEM_ERROR);
+        TS_ASSERT_EQUALS(error, ENOMEM);
+        TS_ASSERT_EQUALS(parseStatus, SMARTOPTIONS_SYSTEM_ERROR);
+        TS_ASSERT_EQUALS(smartOptions.OptionCount(), 0);
+        TS_ASSERT(!verbose);
+    }
+};
@@ -0,0 +1,175 @@
+/**
+ * @file        NetworkArgTest.h
+ *
+ * @brief       Test Network Address Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test the address, endpoint and prefix Option
+ * Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class NetworkArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testAddress_IPv4_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-n", "192.168.0.1" };
+        SmartOptionsIPAddress address;
+        const uint8_t expected[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 192, 168, 0, 1 };
+
+        // Act
+        smartOptions.AddAddressOption(NET_PREFIX_SHORT, NET_PREFIX_LONG, NET_META, NET_HELP, &address);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(address.family, 4);
+        TS_ASSERT_SAME_DATA(address.bytes, expected, sizeof(expected));
+    }
+
+    void testAddress_IPv6_Pass(void)
+    {
+        // Arrange
+        SmartOptionsIPAddress address;
+        const uint8_t loopback[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+        const uint8_t mixed[] = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 1 };
+
+        // Act & Assert
+        TS_ASSERT(SmartOptionsIPAddress::Parse("::1", 3, address));
+        TS_ASSERT_EQUALS(address.family, 6);
+        TS_ASSERT_SAME_DATA(address.bytes, loopback, sizeof(loopback));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("2001:DB8::10.0.0.1", 18, address));
+        TS_ASSERT_SAME_DATA(address.bytes, mixed, sizeof(mixed));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("::", 2, address));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("1:2:3:4:5:6:7:8", 15, address));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("1::", 3, address));
+    }
+
+    void testAddress_Invalid_Fail(void)
+    {
+        // Arrange
+        const char *invalid[] = { "", "1.2.3", "1.2.3.4.5", "256.0.0.1", "01.2.3.4", "1.2.3.4 ", "1:2:3:4:5:6:7:8:9",
+                                  "1::2::3", ":1:2", "1:", "12345::", "::g", ":::", "1:2:3:4:5:6:7:8::" };
+        SmartOptionsIPAddress address;
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(invalid); i++) {
+            TS_ASSERT(!SmartOptionsIPAddress::Parse(invalid[i], strlen(invalid[i]), address));
+        }
+    }
+
+    void testEndpoint_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-n[fe80::1]:8443", "-p", "db.example.com:5432" };
+        SmartOptionsEndpoint listen;
+        SmartOptionsEndpoint peer;
+
+        // Act
+        smartOptions.AddEndpointOption(NET_PREFIX_SHORT, NET_PREFIX_LONG, NET_META, NET_HELP, &listen);
+        smartOptions.AddEndpointOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &peer);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(listen.address.family, 6);
+        TS_ASSERT_EQUALS(listen.port, 8443);
+        TS_ASSERT_EQUALS(peer.address.family, 0);
+        TS_ASSERT_EQUALS(std::string(peer.host, peer.hostLength), "db.example.com");
+        TS_ASSERT_EQUALS(peer.port, 5432);
+    }
+
+    void testEndpoint_Invalid_Fail(void)
+    {
+        // Arrange
+        const char *invalid[] = { "host", "host:", ":80", "host:65536", "fe80::1:80", "[fe80::1]80", "[1.2.3.4]:80", "bad_host:80" };
+        SmartOptionsEndpoint endpoint;
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(invalid); i++) {
+            TS_ASSERT(!SmartOptionsEndpoint::Parse(invalid[i], strlen(invalid[i]), endpoint));
+        }
+    }
+
+    void testEndpoint_MalformedHost_Fail(void)
+    {
+        // Arrange
+        const char *numeric[] = { "999.1.1.1:80", "1.2.3:80", "80:80", "01.2.3.4:80", "example.123:80" };
+        std::string longHost = std::string("[::1") + std::string(65536, '0') + "]:80";
+        SmartOptionsEndpoint endpoint;
+
+        // Act & Assert: numeric names are malformed addresses, the bracketed host is not truncated to "::1"...
+        for (size_t i = 0; i < SIZE_OF_ARRAY(numeric); i++) {
+            TS_ASSERT(!SmartOptionsEndpoint::Parse(numeric[i], strlen(numeric[i]), endpoint));
+        }
+        TS_ASSERT(!SmartOptionsEndpoint::Parse(longHost.data(), longHost.size(), endpoint));
+        TS_ASSERT(SmartOptionsEndpoint::Parse("3com.example:80", 15, endpoint));
+        TS_ASSERT(SmartOptionsEndpoint::Parse("1.2.3.4:80", 10, endpoint));
+        TS_ASSERT_EQUALS(endpoint.address.family, 4);
+    }
+
+    void testPrefix_LeadingZeros_Fail(void)
+    {
+        // Arrange
+        const char *invalid[] = { "0.0.0.0/032", "10.0.0.0/08", "::/000", "10.0.0.0/" };
+        SmartOptionsIPPrefix prefix;
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(invalid); i++) {
+            TS_ASSERT(!SmartOptionsIPPrefix::Parse(invalid[i], strlen(invalid[i]), prefix));
+        }
+        TS_ASSERT(SmartOptionsIPPrefix::Parse("0.0.0.0/0", 9, prefix));
+        TS_ASSERT(SmartOptionsIPPrefix::Parse("10.0.0.0/32", 11, prefix));
+    }
+
+    void testPrefix_HostBits_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-n", "10.0.0.1/8" };
+        SmartOptionsIPPrefix prefix;
+
+        // Act
+        smartOptions.AddPrefixOption(NET_PREFIX_SHORT, NET_PREFIX_LONG, NET_META, NET_HELP, &prefix);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+
+    void testPrefixTable_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-n", "10.1.0.0/16", "-n", "192.168.0.0/24", "-n", "10.0.0.0/8", "-n", "fd00::/8" };
+        SmartOptionsIPPrefixTable allowList;
+        SmartOptionsIPAddress address;
+
+        // Act
+        smartOptions.AddPrefixOption(NET_PREFIX_SHORT, NET_PREFIX_LONG, NET_META, NET_HELP, &allowList);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(allowList.Prefixes().size(), (size_t)4);
+        TS_ASSERT_EQUALS(allowList.Prefixes()[0].prefixLength, 8);      // 10.0.0.0/8 sorts first...
+        TS_ASSERT(SmartOptionsIPAddress::Parse("10.255.0.1", 10, address) && allowList.Contains(address));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("192.168.0.255", 13, address) && allowList.Contains(address));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("192.168.1.0", 11, address) && !allowList.Contains(address));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("11.0.0.0", 8, address) && !allowList.Contains(address));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("fdff::1", 7, address) && allowList.Contains(address));
+        TS_ASSERT(SmartOptionsIPAddress::Parse("fe00::", 6, address) && !allowList.Contains(address));
+    }
+};
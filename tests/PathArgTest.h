@@ -0,0 +1,89 @@
+/**
+ * @file        PathArgTest.h
+ *
+ * @brief       Test Path Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test Path Option Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include <stdio.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class PathArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        std::ofstream file(PATH_FILE);
+    }
+
+    void tearDown()
+    {
+        remove(PATH_FILE);
+    }
+
+    void testPath_Checks_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-i", PATH_FILE, "-d", ".", "-o", PATH_MISSING };
+        const char *input = NULL;
+        const char *directory = NULL;
+        const char *output = NULL;
+        const char *unused = NULL;
+
+        // Act
+        smartOptions.AddPathOption(PATH_PREFIX_SHORT, PATH_PREFIX_LONG, PATH_META, PATH_HELP, SMARTOPTIONS_PATH_READABLE, &input);
+        smartOptions.AddPathOption('d', "dir", PATH_META, PATH_HELP, SMARTOPTIONS_PATH_DIRECTORY, &directory);
+        smartOptions.AddPathOption('o', "output", PATH_META, PATH_HELP, SMARTOPTIONS_PATH_WRITABLE_PARENT, &output);
+        smartOptions.AddPathOption('u', "unused", PATH_META, PATH_HELP, SMARTOPTIONS_PATH_EXISTS, &unused);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_SAME_DATA(input, PATH_FILE, strlen(PATH_FILE));
+        TS_ASSERT_SAME_DATA(output, PATH_MISSING, strlen(PATH_MISSING));
+        TS_ASSERT(NULL == unused);
+    }
+
+    void testPath_Missing_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-i", PATH_MISSING };
+        const char *input = NULL;
+
+        // Act
+        smartOptions.AddPathOption(PATH_PREFIX_SHORT, PATH_PREFIX_LONG, PATH_META, PATH_HELP, SMARTOPTIONS_PATH_EXISTS, &input);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+
+    void testPath_NotDirectory_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-d", PATH_FILE, "-o", PATH_MISSING "/output" };
+        const char *directory = NULL;
+        const char *output = NULL;
+
+        // Act
+        smartOptions.AddPathOption('d', "dir", PATH_META, PATH_HELP, SMARTOPTIONS_PATH_DIRECTORY, &directory);
+        smartOptions.AddPathOption('o', "output", PATH_META, PATH_HELP, SMARTOPTIONS_PATH_WRITABLE_PARENT, &output);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+};
@@ -0,0 +1,191 @@
+/**
+ * @file        PluginTableTest.h
+ *
+ * @brief       Test the option tables of plugins.
+ *
+ * @details     This file contains a CxxTest test-suite to test the attachment of a plugin option table to the
+ * SmartOptions library, with a table built in this file like a plugin would export it, and with the test plugin of
+ * tests/plugin, a shared object built by the Makefile.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <sstream>
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+#include "plugin/SmartOptionsTestPlugin.h"
+
+struct PluginTestConfig {
+    int level;
+    double ratio;
+    bool verbose;
+};
+
+static PluginTestConfig pluginTestConfig;
+static constexpr SmartOptionsMember pluginTestMembers[] = {
+    SMARTOPTIONS_MEMBER(PluginTestConfig, level, 'l', "level", "LEVEL", "The level"),
+    SMARTOPTIONS_MEMBER(PluginTestConfig, ratio, FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP),
+    SMARTOPTIONS_MEMBER(PluginTestConfig, verbose, JSON_FLAG_SHORT, JSON_FLAG_LONG, NULL, JSON_FLAG_HELP),
+};
+static const SmartOptionsPluginTable pluginTestTable = {
+    SMARTOPTIONS_PLUGIN_ABI_VERSION, PLUGIN_NAME, pluginTestMembers, SIZE_OF_ARRAY(pluginTestMembers), &pluginTestConfig
+};
+
+class PluginTableTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testPluginTable_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_1_SS, "-l", "3", "-v", "-r0.5" };
+        const char *optionO = NULL;
+        pluginTestConfig = PluginTestConfig();
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        SMARTOPTIONS_STATUS attachStatus = smartOptions.AttachPlugin(pluginTestTable);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert: the options of the plugin follow the options of the host...
+        TS_ASSERT_EQUALS(attachStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_SAME_DATA(optionO, OPTION_ARGUMENT_1, strlen(OPTION_ARGUMENT_1));
+        TS_ASSERT_EQUALS(pluginTestConfig.level, 3);
+        TS_ASSERT_EQUALS(pluginTestConfig.ratio, 0.5);
+        TS_ASSERT(pluginTestConfig.verbose);
+        TS_ASSERT_EQUALS(smartOptions.FindOption(JSON_FLAG_LONG), 3u);
+        TS_ASSERT_EQUALS(std::string(smartOptions.GetHelpText(2).helpString), FLOAT_HELP);
+        TS_ASSERT(smartOptions.GetResult().IsSet(1));
+    }
+
+    void testPluginTable_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        SmartOptionsPluginTable otherVersion = pluginTestTable;
+        const char *argV[] = { "SmartOptions", "-l", "high" };
+        bool verbose = false;
+        otherVersion.abiVersion = SMARTOPTIONS_PLUGIN_ABI_VERSION + 1;
+        pluginTestConfig = PluginTestConfig();
+
+        // Act
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        SMARTOPTIONS_STATUS collisionStatus = smartOptions.AttachPlugin(pluginTestTable);
+        SMARTOPTIONS_STATUS versionStatus = smartOptions.AttachPlugin(otherVersion);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert: nothing of the plugin is attached...
+        TS_ASSERT_EQUALS(collisionStatus, SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(versionStatus, SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(smartOptions.FindOption(FLOAT_PREFIX_LONG), SmartOptions::INVALID_OPTION_ID);
+        TS_ASSERT_EQUALS(pluginTestConfig.level, 0);
+    }
+
+    void testPluginTable_InvalidValue_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-l", "high" };
+
+        // Act
+        smartOptions.AttachPlugin(pluginTestTable);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_FORMAT);
+    }
+
+    void testPluginTable_Parse_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *invalidArgs[] = { "SmartOptions", "-l", "high" };
+        const char *validArgs[] = { "SmartOptions", "-l", "4", "-r0.5" };
+        SmartOptionsResult result;
+        pluginTestConfig = PluginTestConfig();
+
+        // Act
+        smartOptions.AttachPlugin(pluginTestTable);
+        SMARTOPTIONS_STATUS invalidStatus = smartOptions.Parse(SIZE_OF_ARRAY(invalidArgs), invalidArgs, result);
+        SMARTOPTIONS_STATUS validStatus = smartOptions.Parse(SIZE_OF_ARRAY(validArgs), validArgs, result);
+
+        // Assert: the values are checked, the struct of the plugin is not written...
+        TS_ASSERT_EQUALS(invalidStatus, SMARTOPTIONS_INVALID_FORMAT);
+        TS_ASSERT_EQUALS(validStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT(result.IsSet(0));
+        TS_ASSERT_EQUALS(pluginTestConfig.level, 0);
+        TS_ASSERT_EQUALS(pluginTestConfig.ratio, 0.0);
+    }
+
+    void testPluginTable_ParseSilent_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", true);
+        const char *argV[] = { "SmartOptions", "-l", "high" };
+        SmartOptionsResult result;
+        std::ostringstream output;
+
+        // Act
+        smartOptions.AttachPlugin(pluginTestTable);
+        std::streambuf *console = std::cout.rdbuf(output.rdbuf());
+        SMARTOPTIONS_STATUS status = smartOptions.Parse(SIZE_OF_ARRAY(argV), argV, result);
+        std::cout.rdbuf(console);
+
+        // Assert: Parse() reports the invalid value by its status only, even with the automatic help...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_FORMAT);
+        TS_ASSERT(output.str().empty());
+    }
+
+    void testPluginTable_SharedObject_Pass(void)
+    {
+        // Arrange
+        SmartOptionsPlugin plugin;
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        std::vector<const char *> argV = { "SmartOptions", "-l3", "-r0.5", "-v" };
+
+        // Act
+        SMARTOPTIONS_STATUS openStatus = plugin.Open(PLUGIN_PATH);
+        TS_ASSERT_EQUALS(openStatus, SMARTOPTIONS_SUCCESS);
+        if (SMARTOPTIONS_SUCCESS != openStatus) return;
+        const TestPluginConfig *config = static_cast<const TestPluginConfig *>(plugin.Table()->storage);
+        SMARTOPTIONS_STATUS attachStatus = smartOptions.AttachPlugin(*plugin.Table());
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs((int)argV.size(), argV.data());
+        int level = config->level;
+        double ratio = config->ratio;
+        argV.erase(argV.begin() + 1);
+        SMARTOPTIONS_STATUS editStatus = smartOptions.ProcessCommandArgsEdit((int)argV.size(), argV.data(), SMARTOPTIONS_EDIT_DELETE, 1);
+
+        // Assert: the deleted option gets back the value it had before the first command line...
+        TS_ASSERT_EQUALS(std::string(plugin.Table()->name), PLUGIN_NAME);
+        TS_ASSERT_EQUALS(plugin.Table()->abiVersion, (uint32_t)SMARTOPTIONS_PLUGIN_ABI_VERSION);
+        TS_ASSERT_EQUALS(attachStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(level, 3);
+        TS_ASSERT_EQUALS(ratio, 0.5);
+        TS_ASSERT_EQUALS(editStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(config->level, TEST_PLUGIN_DEFAULT_LEVEL);
+        TS_ASSERT_EQUALS(config->ratio, 0.5);
+        TS_ASSERT(config->verbose);
+    }
+
+    void testPluginTable_MissingPlugin_Fail(void)
+    {
+        // Arrange
+        SmartOptionsPlugin plugin;
+
+        // Act
+        SMARTOPTIONS_STATUS status = plugin.Open(PLUGIN_MISSING_PATH);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SYSTEM_ERROR);
+        TS_ASSERT(NULL == plugin.Table());
+    }
+};
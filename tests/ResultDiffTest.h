@@ -0,0 +1,66 @@
+/**
+ * @file        ResultDiffTest.h
+ *
+ * @brief       Test the change-set diff between parse results.
+ *
+ * @details     This file contains a CxxTest test-suite to test SmartOptionsResult::Diff() of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class ResultDiffTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testResultDiff_Changed_Pass(void)
+    {
+        // Arrange: options beyond the first seen word, to cover more than one word...
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *optionValues[70];
+        static char prefixes[70];
+        for (size_t index = 0; index < SIZE_OF_ARRAY(optionValues); index++) {
+            prefixes[index] = (char)('0' + index);
+            smartOptions.AddOption(prefixes[index], NULL, OPT_META_1, OPT_HELP_1, &optionValues[index]);
+        }
+        const char *argV1[] = { "SmartOptions", "-0same", "-1old", "-2gone", "-tsame", "-uold" };
+        const char *argV2[] = { "SmartOptions", "-uold", "-tsame", "-1new", "-0same", "-3added", "-unew" };
+
+        // Act
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV1), argV1);
+        SmartOptionsResult before = smartOptions.GetResult();
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV2), argV2);
+        std::vector<unsigned> changed;
+        SMARTOPTIONS_STATUS status = before.Diff(smartOptions.GetResult(), changed);
+
+        // Assert
+        const unsigned expected[] = { 1, 2, 3, 'u' - '0' };
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(changed, std::vector<unsigned>(expected, expected + SIZE_OF_ARRAY(expected)));
+    }
+
+    void testResultDiff_OtherOptions_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        SmartOptions otherOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions" };
+        const char *optionO = NULL;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        otherOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        std::vector<unsigned> changed;
+
+        // Act
+        SMARTOPTIONS_STATUS status = smartOptions.GetResult().Diff(otherOptions.GetResult(), changed);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_INVALID_ARGUMENT);
+    }
+};
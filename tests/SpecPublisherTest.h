@@ -0,0 +1,124 @@
+/**
+ * @file        SpecPublisherTest.h
+ *
+ * @brief       Test publishing and replacing options at run time.
+ *
+ * @details     This file contains a CxxTest test-suite to test SmartOptions::Parse() and SmartOptionsSpecPublisher
+ * of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+/**
+ * @brief Creates the options used by the tests, optionally with the second option and a double.
+ */
+static std::unique_ptr<const SmartOptions> createSpec(bool isExtended)
+{
+    static const char *optionO;
+    static const char *optionP;
+    static double ratio;
+
+    std::unique_ptr<SmartOptions> spec(new SmartOptions("SmartOptionsTest", false));
+    spec->AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+    if (isExtended) {
+        spec->AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        spec->AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+    }
+    return std::unique_ptr<const SmartOptions>(spec.release());
+}
+
+class SpecPublisherTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testParse_NoVariables_Pass(void)
+    {
+        // Arrange
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_1_SM, "-r0.5" };
+        const char *argVInvalid[] = { "SmartOptions", "-r", "half" };
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *optionO = NULL;
+        double ratio = 1.0;
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        SmartOptionsResult result;
+
+        // Act
+        SMARTOPTIONS_STATUS status = smartOptions.Parse(SIZE_OF_ARRAY(argV), argV, result);
+        SmartOptionsResult invalidResult;
+        SMARTOPTIONS_STATUS invalidStatus = smartOptions.Parse(SIZE_OF_ARRAY(argVInvalid), argVInvalid, invalidResult);
+
+        // Assert: the values are recorded and checked, the variables are untouched...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(result.Value(0), argV[2]);
+        TS_ASSERT_EQUALS(std::string(result.Value(1)), "0.5");
+        TS_ASSERT(NULL == optionO);
+        TS_ASSERT_EQUALS(ratio, 1.0);
+        TS_ASSERT_EQUALS(invalidStatus, SMARTOPTIONS_INVALID_FORMAT);
+    }
+
+    void testSpecPublisher_InFlight_Pass(void)
+    {
+        // Arrange
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_2_SM };
+        SmartOptionsSpecPublisher publisher(createSpec(false));
+        SmartOptionsResult result;
+
+        // Act: a request is in flight while the options are replaced...
+        SMARTOPTIONS_STATUS oldStatus;
+        {
+            SmartOptionsSpecPublisher::Guard inFlight = publisher.Acquire();
+            publisher.Publish(createSpec(true));
+            TS_ASSERT_EQUALS(publisher.Reclaim(), 1);
+            oldStatus = inFlight->Parse(SIZE_OF_ARRAY(argV), argV, result);
+        }
+        size_t retiredCount = publisher.Reclaim();
+        SMARTOPTIONS_STATUS newStatus = publisher.Acquire()->Parse(SIZE_OF_ARRAY(argV), argV, result);
+
+        // Assert: the request finished with the options it started with...
+        TS_ASSERT_EQUALS(oldStatus, SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(retiredCount, 0);
+        TS_ASSERT_EQUALS(newStatus, SMARTOPTIONS_SUCCESS);
+    }
+
+    void testSpecPublisher_Concurrent_Pass(void)
+    {
+        // Arrange
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_1_SM, "-o" OPTION_ARGUMENT_2 };
+        SmartOptionsSpecPublisher publisher(createSpec(false));
+        std::atomic<bool> isDone(false);
+        std::atomic<size_t> failures(0);
+        std::atomic<size_t> parses(0);
+
+        // Act: requests keep processing command lines, while the options are replaced...
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < 4; thread++) {
+            threads.push_back(std::thread([&]() {
+                SmartOptionsResult result;
+                while (false == isDone.load() || parses.load() < 100) {
+                    SmartOptionsSpecPublisher::Guard options = publisher.Acquire();
+                    if (SMARTOPTIONS_SUCCESS != options->Parse(SIZE_OF_ARRAY(argV), argV, result)) failures++;
+                    parses++;
+                }
+            }));
+        }
+        for (int update = 0; update < 200; update++) {
+            publisher.Publish(createSpec(0 != (update % 2)));
+        }
+        isDone.store(true);
+        for (size_t index = 0; index < threads.size(); index++) {
+            threads[index].join();
+        }
+
+        // Assert
+        TS_ASSERT_EQUALS(failures.load(), 0);
+        TS_ASSERT_EQUALS(publisher.Reclaim(), 0);
+    }
+};
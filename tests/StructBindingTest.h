@@ -0,0 +1,191 @@
+/**
+ * @file        StructBindingTest.h
+ *
+ * @brief       Test Struct Binding.
+ *
+ * @details     This file contains a CxxTest test-suite to test the binding of Command Line arguments to the members
+ * of a struct, through SmartOptionsStructBinding.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+struct TestConfig {
+    const char *name;
+    const char *option;
+    int level;
+    double ratio;
+    bool verbose;
+};
+
+static constexpr SmartOptionsMember testConfigMembers[] = {
+    SMARTOPTIONS_MEMBER(TestConfig, option, OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1),
+    SMARTOPTIONS_MEMBER(TestConfig, level, 'l', "level", "LEVEL", "The level"),
+    SMARTOPTIONS_MEMBER(TestConfig, ratio, FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP),
+    SMARTOPTIONS_MEMBER(TestConfig, verbose, 'v', "verbose", NULL, "Verbose output"),
+    SMARTOPTIONS_POSITIONAL_MEMBER(TestConfig, name, "NAME", "The name"),
+};
+static constexpr SmartOptionsStructBinding<TestConfig, SIZE_OF_ARRAY(testConfigMembers)> testConfigBinding(testConfigMembers);
+
+// A member type which accumulates its values, and records the order of the conversions...
+static int testTagSequence = 0;
+
+struct TestTagList {
+    int count;
+    int sum;
+    int sequence;
+};
+
+template <>
+struct SmartOptionsConverter<TestTagList> {
+    static SMARTOPTIONS_STATUS parse(std::string_view value, TestTagList &result) {
+        int tag = 0;
+        SMARTOPTIONS_STATUS status = SmartOptionsConverter<int>::parse(value, tag);
+        if (SMARTOPTIONS_SUCCESS != status) return status;
+        result.count++;
+        result.sum += tag;
+        result.sequence = ++testTagSequence;
+        return SMARTOPTIONS_SUCCESS;
+    }
+};
+
+struct TestTags {
+    TestTagList tags;
+    TestTagList labels;
+    int level;
+    bool verbose;
+};
+
+static constexpr SmartOptionsMember testTagsMembers[] = {
+    SMARTOPTIONS_MEMBER(TestTags, tags, 't', "tag", "TAG", "A tag"),
+    SMARTOPTIONS_MEMBER(TestTags, labels, 'L', "label", "LABEL", "A label"),
+    SMARTOPTIONS_MEMBER(TestTags, level, 'l', "level", "LEVEL", "The level"),
+    SMARTOPTIONS_MEMBER(TestTags, verbose, 'v', "verbose", NULL, "Verbose output"),
+};
+static constexpr SmartOptionsStructBinding<TestTags, SIZE_OF_ARRAY(testTagsMembers)> testTagsBinding(testTagsMembers);
+
+class StructBindingTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testStructBinding_Pass(void)
+    {
+        // Arrange
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_1_SS, "-l", "3", "-v", POSITIONAL_ARGUMENT_1, "-r0.5" };
+        TestConfig config = TestConfig();
+
+        // Act
+        SMARTOPTIONS_STATUS status = testConfigBinding.Parse(SIZE_OF_ARRAY(argV), argV, config);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_SAME_DATA(config.option, OPTION_ARGUMENT_1, strlen(OPTION_ARGUMENT_1));
+        TS_ASSERT_SAME_DATA(config.name, POSITIONAL_ARGUMENT_1, strlen(POSITIONAL_ARGUMENT_1));
+        TS_ASSERT_EQUALS(config.level, 3);
+        TS_ASSERT_EQUALS(config.ratio, 0.5);
+        TS_ASSERT(config.verbose);
+    }
+
+    void testStructBinding_Fail(void)
+    {
+        // Arrange
+        const char *unknown[] = { "SmartOptions", "-x", POSITIONAL_ARGUMENT_1 };
+        const char *invalidValue[] = { "SmartOptions", "-l", "high", POSITIONAL_ARGUMENT_1 };
+        const char *missingPositional[] = { "SmartOptions", "-v" };
+        TestConfig config = TestConfig();
+        std::string errMessage;
+
+        // Act & Assert
+        TS_ASSERT_EQUALS(testConfigBinding.Parse(SIZE_OF_ARRAY(unknown), unknown, config), SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(testConfigBinding.Parse(SIZE_OF_ARRAY(invalidValue), invalidValue, config, &errMessage), SMARTOPTIONS_INVALID_FORMAT);
+        TS_ASSERT_EQUALS(errMessage, "Error, invalid value 'high'.");
+        TS_ASSERT_EQUALS(testConfigBinding.Parse(SIZE_OF_ARRAY(missingPositional), missingPositional, config), SMARTOPTIONS_INVALID_NUMBEROF_ARGUMENTS);
+    }
+
+    void testStructBinding_RepeatedOption_Pass(void)
+    {
+        // Arrange
+        const char *argV[] = { "SmartOptions", "-t1", "-l", "3", "-t", "2", "-v", "-t4", "-l5", "-v" };
+        TestTags tags = TestTags();
+
+        // Act
+        SMARTOPTIONS_STATUS status = testTagsBinding.Parse(SIZE_OF_ARRAY(argV), argV, tags);
+
+        // Assert: every occurrence is converted, the last one wins for plain members...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(tags.tags.count, 3);
+        TS_ASSERT_EQUALS(tags.tags.sum, 7);
+        TS_ASSERT_EQUALS(tags.level, 5);
+        TS_ASSERT(tags.verbose);
+    }
+
+    void testStructBinding_ScanRepeatedOption_Fail(void)
+    {
+        // Arrange
+        static constexpr const char *repeated[] = { "SmartOptions", "-t1", "-v", "-t2" };
+        static constexpr const char *repeatedFlag[] = { "SmartOptions", "-v", "-t1", "-v" };
+
+        // Act
+        static constexpr SmartOptionsScanResult<SIZE_OF_ARRAY(testTagsMembers)> scan =
+            testTagsBinding.Scan(SIZE_OF_ARRAY(repeated), repeated);
+        static constexpr SmartOptionsScanResult<SIZE_OF_ARRAY(testTagsMembers)> flagScan =
+            testTagsBinding.Scan(SIZE_OF_ARRAY(repeatedFlag), repeatedFlag);
+
+        // Assert: a scan holds one value per member, only flags may repeat...
+        TS_ASSERT_EQUALS(scan.status, SMARTOPTIONS_INVALID_ARGUMENT);
+        TS_ASSERT_EQUALS(std::string(scan.reason), "repeated option");
+        TS_ASSERT_EQUALS(scan.errorIndex, 3);
+        TS_ASSERT_EQUALS(flagScan.status, SMARTOPTIONS_SUCCESS);
+    }
+
+    void testStructBinding_ApplyOrder_Pass(void)
+    {
+        // Arrange
+        static constexpr const char *argV[] = { "SmartOptions", "-L1", "-l", "3", "-t2" };
+        static constexpr SmartOptionsScanResult<SIZE_OF_ARRAY(testTagsMembers)> scan = testTagsBinding.Scan(SIZE_OF_ARRAY(argV), argV);
+        TestTags tags = TestTags();
+
+        // Act
+        SMARTOPTIONS_STATUS status = testTagsBinding.Apply(scan, tags);
+
+        // Assert: the values are converted in command line order, not in member table order...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(tags.level, 3);
+        TS_ASSERT_EQUALS(tags.labels.sum, 1);
+        TS_ASSERT_EQUALS(tags.tags.sum, 2);
+        TS_ASSERT_LESS_THAN(tags.labels.sequence, tags.tags.sequence);
+    }
+
+    void testStructBinding_Parallel_Pass(void)
+    {
+        // Arrange
+        static const char *levels[] = { "0", "1", "2", "3", "4", "5", "6", "7" };
+        TestConfig configs[SIZE_OF_ARRAY(levels)];
+        SMARTOPTIONS_STATUS statuses[SIZE_OF_ARRAY(levels)];
+        std::vector<std::thread> threads;
+
+        // Act: every thread fills its own copy of the struct from its own command line...
+        for (size_t i = 0; i < SIZE_OF_ARRAY(levels); i++) {
+            threads.push_back(std::thread([&configs, &statuses, i]() {
+                const char *argV[] = { "SmartOptions", "-l", levels[i], POSITIONAL_ARGUMENT_1 };
+                configs[i] = TestConfig();
+                statuses[i] = testConfigBinding.Parse(SIZE_OF_ARRAY(argV), argV, configs[i]);
+            }));
+        }
+        for (size_t i = 0; i < threads.size(); i++) {
+            threads[i].join();
+        }
+
+        // Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(levels); i++) {
+            TS_ASSERT_EQUALS(statuses[i], SMARTOPTIONS_SUCCESS);
+            TS_ASSERT_EQUALS(configs[i].level, (int)i);
+        }
+    }
+};
@@ -0,0 +1,146 @@
+/**
+ * @file        TelemetryTest.h
+ *
+ * @brief       Test the per option hit counters.
+ *
+ * @details     This file contains a CxxTest test-suite to test the telemetry of the SmartOptions library, which is
+ * only compiled when SMARTOPTIONS_TELEMETRY is defined; the tests are skipped otherwise.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+#if defined(SMARTOPTIONS_TELEMETRY)
+#include <sys/wait.h>
+#endif
+
+class TelemetryTestSuite : public CxxTest::TestSuite
+{
+public:
+    void tearDown()
+    {
+#if defined(SMARTOPTIONS_TELEMETRY)
+        SmartOptions("SmartOptionsTest", false).SetTelemetryFile(NULL);
+#endif
+        remove(TELEMETRY_FILE_PATH);
+    }
+
+    void testTelemetry_HitCount_Pass(void)
+    {
+#if defined(SMARTOPTIONS_TELEMETRY)
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-v", OPTION_ARGUMENT_1_SM, POSITIONAL_ARGUMENT_1 };
+        const char *optionO = NULL;
+        const char *optionP = NULL;
+        bool verbose = false;
+        const char *positional = NULL;
+        SmartOptionsResult result;
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_2, OPT_PREFIX_LONG_2, OPT_META_2, OPT_HELP_2, &optionP);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+        uint64_t hitCountBefore = smartOptions.HitCount(0);
+        smartOptions.SetTelemetryFile(TELEMETRY_FILE_PATH);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        SMARTOPTIONS_STATUS parseStatus = smartOptions.Parse(SIZE_OF_ARRAY(argV), argV, result);
+        argV[1] = OPTION_ARGUMENT_2_SS;
+        SMARTOPTIONS_STATUS editStatus = smartOptions.ProcessCommandArgsEdit(SIZE_OF_ARRAY(argV), argV, SMARTOPTIONS_EDIT_REPLACE, 1);
+
+        // Assert: nothing is counted before the telemetry file is set, nor by Parse() and the edit...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(parseStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(editStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(hitCountBefore, 0);
+        TS_ASSERT_EQUALS(smartOptions.HitCount(0), 1);
+        TS_ASSERT_EQUALS(smartOptions.HitCount(1), 0);
+        TS_ASSERT_EQUALS(smartOptions.HitCount(2), 1);
+        TS_ASSERT_EQUALS(smartOptions.HitCount(3), 1);
+#else
+        TS_SKIP("SMARTOPTIONS_TELEMETRY is not defined");
+#endif
+    }
+
+    void testTelemetry_FlushAppends_Pass(void)
+    {
+#if defined(SMARTOPTIONS_TELEMETRY)
+        // Arrange
+        const char *argV[] = { "SmartOptions", "-v", POSITIONAL_ARGUMENT_1 };
+        const char *optionO = NULL;
+        bool verbose = false;
+        const char *positional = NULL;
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, NULL, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+
+        // Act: flushed twice explicitly, the copy counts into the same counters...
+        smartOptions.SetTelemetryFile(TELEMETRY_FILE_PATH);
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        SMARTOPTIONS_STATUS firstStatus = smartOptions.FlushTelemetry();
+        uint64_t hitCount = smartOptions.HitCount(1);
+        {
+            SmartOptions copy = smartOptions;
+            copy.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        }
+        smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+        SMARTOPTIONS_STATUS secondStatus = smartOptions.FlushTelemetry();
+        std::ifstream file(TELEMETRY_FILE_PATH);
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        // Assert: destroying the copy writes nothing...
+        TS_ASSERT_EQUALS(firstStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(secondStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(hitCount, 0);
+        TS_ASSERT_EQUALS(content, std::string(
+                "SmartOptionsTest o=0 verbose=1 PositionArgument-1=1\n"
+                "SmartOptionsTest o=0 verbose=2 PositionArgument-1=2\n"));
+#else
+        TS_SKIP("SMARTOPTIONS_TELEMETRY is not defined");
+#endif
+    }
+
+    void testTelemetry_FlushAtExit_Pass(void)
+    {
+#if defined(SMARTOPTIONS_TELEMETRY)
+        // Arrange
+        const char *argV[] = { "SmartOptions", "-v", POSITIONAL_ARGUMENT_1 };
+        int childStatus = -1;
+
+        // Act: a process with a spec, a copy and a replacement of the copy exits...
+        fflush(NULL);
+        pid_t pid = fork();
+        if (0 == pid) {
+            bool verbose = false;
+            const char *positional = NULL;
+            SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+            smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+            smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+            smartOptions.SetTelemetryFile(TELEMETRY_FILE_PATH);
+            SmartOptions copy = smartOptions;
+            copy.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+            copy = smartOptions;
+            copy.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+            exit(0);
+        }
+        waitpid(pid, &childStatus, 0);
+        std::ifstream file(TELEMETRY_FILE_PATH);
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        // Assert: a single line, with the hits of all the copies...
+        TS_ASSERT_EQUALS(childStatus, 0);
+        TS_ASSERT_EQUALS(content, std::string("SmartOptionsTest verbose=2 PositionArgument-1=2\n"));
+#else
+        TS_SKIP("SMARTOPTIONS_TELEMETRY is not defined");
+#endif
+    }
+};
@@ -0,0 +1,85 @@
+/**
+ * @file        TimestampArgTest.h
+ *
+ * @brief       Test Timestamp Option Arguments.
+ *
+ * @details     This file contains a CxxTest test-suite to test ISO-8601 timestamp Option Arguments of SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class TimestampArgTestSuite : public CxxTest::TestSuite
+{
+public:
+    void testTimestamp_UTC_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-s", "2024-03-01T12:30:05.25Z" };
+        SmartOptionsTimestamp since;
+
+        // Act
+        smartOptions.AddOption(TIME_PREFIX_SHORT, TIME_PREFIX_LONG, TIME_META, TIME_HELP, &since);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(since.time_since_epoch().count(), 1709296205250000000LL);
+    }
+
+    void testTimestamp_Forms_Pass(void)
+    {
+        // Arrange
+        const char *sameInstant[] = { "2000-01-01T01:30:00+01:30", "2000-01-01t00:00:00z", "2000-01-01 02:00:00+0200",
+                                      "1999-12-31T23:00:00-01", "2000-01-01", "2000-01-01T00:00:00.000000000123Z" };
+        SmartOptionsTimestamp timestamp;
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(sameInstant); i++) {
+            TS_ASSERT_EQUALS(SmartOptionsParseTimestamp(sameInstant[i], strlen(sameInstant[i]), timestamp), SMARTOPTIONS_SUCCESS);
+            TS_ASSERT_EQUALS(timestamp.time_since_epoch().count(), 946684800LL * 1000000000);
+        }
+        TS_ASSERT_EQUALS(SmartOptionsParseTimestamp("1969-12-31T23:59:59.5Z", 22, timestamp), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(timestamp.time_since_epoch().count(), -500000000LL);
+    }
+
+    void testTimestamp_Format_Fail(void)
+    {
+        // Arrange
+        const char *invalid[] = { "2024-03-01T12:30:00", "2024-3-01", "2024-03-01T12:30Z", "2024-03-01T12:30:00.Z",
+                                  "2024-03-01X12:30:00Z", "2024-03-01T12:30:00+1", "2024-03-01T12:30:00Zulu", "yesterday" };
+        SmartOptionsTimestamp timestamp;
+
+        // Act & Assert
+        for (size_t i = 0; i < SIZE_OF_ARRAY(invalid); i++) {
+            TS_ASSERT_EQUALS(SmartOptionsParseTimestamp(invalid[i], strlen(invalid[i]), timestamp), SMARTOPTIONS_INVALID_FORMAT);
+        }
+    }
+
+    void testTimestamp_Range_Fail(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", "-s", "2023-02-29" };
+        SmartOptionsTimestamp since;
+        SmartOptionsTimestamp timestamp;
+
+        // Act
+        smartOptions.AddOption(TIME_PREFIX_SHORT, TIME_PREFIX_LONG, TIME_META, TIME_HELP, &since);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(SIZE_OF_ARRAY(argV), argV);
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_OUT_OF_RANGE);
+        TS_ASSERT_EQUALS(SmartOptionsParseTimestamp("2024-02-29", 10, timestamp), SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(SmartOptionsParseTimestamp("2024-01-01T24:00:00Z", 20, timestamp), SMARTOPTIONS_OUT_OF_RANGE);
+        TS_ASSERT_EQUALS(SmartOptionsParseTimestamp("2500-01-01", 10, timestamp), SMARTOPTIONS_OUT_OF_RANGE);
+    }
+};
@@ -0,0 +1,111 @@
+/**
+ * @file        TokenChainTest.h
+ *
+ * @brief       Test the command line parameters read from a chain of sources.
+ *
+ * @details     This file contains a CxxTest test-suite to test the processing of environment variables, response
+ * files and argv as a single command line in SmartOptions library.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include <cxxtest/TestSuite.h>
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "CommonData.h"
+#include "CommonUtils.h"
+
+class TokenChainTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        setenv(CHAIN_ENV_NAME, "  -v -o 'Option Argument'  ", 1);
+        std::ofstream file(CHAIN_FILE_PATH, std::ios::out | std::ios::binary);
+        file << "-r 0.5\n\"" POSITIONAL_ARGUMENT_1 "\"\n-o\n";
+    }
+
+    void tearDown()
+    {
+        unsetenv(CHAIN_ENV_NAME);
+        remove(CHAIN_FILE_PATH);
+    }
+
+    void testTokenChain_EnvironmentAndArgv_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", POSITIONAL_ARGUMENT_1 };
+        const char *optionO = NULL;
+        bool verbose = false;
+        const char *positional = NULL;
+        SmartOptionsTokenChain chain(argV[0]);
+
+        // Act
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddFlag(JSON_FLAG_SHORT, JSON_FLAG_LONG, JSON_FLAG_HELP, &verbose);
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+        chain.AddEnvironment(CHAIN_ENV_NAME);
+        chain.AddEnvironment("SMARTOPTIONS_UNSET");
+        chain.AddTokens(SIZE_OF_ARRAY(argV) - 1, argV + 1, SMARTOPTIONS_SOURCE_COMMAND_LINE);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(chain);
+        const SmartOptionsResult &result = smartOptions.GetResult();
+
+        // Assert: the quoted value keeps its white space, and the positional argument is read from argv...
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(chain.Count(), 5);
+        TS_ASSERT(verbose);
+        TS_ASSERT_EQUALS(std::string(optionO), "Option Argument");
+        TS_ASSERT_EQUALS(positional, argV[1]);
+        TS_ASSERT_EQUALS(result.Source(0), SMARTOPTIONS_SOURCE_ENVIRONMENT);
+        TS_ASSERT_EQUALS(result.Source(1), SMARTOPTIONS_SOURCE_ENVIRONMENT);
+        TS_ASSERT_EQUALS(result.Source(2), SMARTOPTIONS_SOURCE_COMMAND_LINE);
+    }
+
+    void testTokenChain_ResponseFile_Pass(void)
+    {
+        // Arrange
+        SmartOptions smartOptions = SmartOptions("SmartOptionsTest", false);
+        const char *argV[] = { "SmartOptions", OPTION_ARGUMENT_1 };
+        const char *optionO = NULL;
+        double ratio = 0.0;
+        const char *positional = NULL;
+        SmartOptionsTokenChain chain(argV[0]);
+        SmartOptionsResult result;
+
+        // Act: the value of the last option of the file is the first parameter of argv...
+        smartOptions.AddOption(OPT_PREFIX_SHORT_1, OPT_PREFIX_LONG_1, OPT_META_1, OPT_HELP_1, &optionO);
+        smartOptions.AddOption(FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP, &ratio);
+        smartOptions.AddPositionalArgument(POSITIONAL_ARGUMENT_1, OPT_HELP_1, &positional);
+        SMARTOPTIONS_STATUS fileStatus = chain.AddResponseFile(CHAIN_FILE_PATH);
+        chain.AddTokens(SIZE_OF_ARRAY(argV) - 1, argV + 1, SMARTOPTIONS_SOURCE_COMMAND_LINE);
+        SMARTOPTIONS_STATUS parseStatus = smartOptions.Parse(chain, result);
+        SMARTOPTIONS_STATUS status = smartOptions.ProcessCommandArgs(chain);
+
+        // Assert
+        TS_ASSERT_EQUALS(fileStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(parseStatus, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SUCCESS);
+        TS_ASSERT_EQUALS(result.Value(0), argV[1]);
+        TS_ASSERT_EQUALS(result.Source(0), SMARTOPTIONS_SOURCE_RESPONSE_FILE);
+        TS_ASSERT_EQUALS(result.Source(1), SMARTOPTIONS_SOURCE_RESPONSE_FILE);
+        TS_ASSERT_EQUALS(std::string(result.Value(2)), POSITIONAL_ARGUMENT_1);
+        TS_ASSERT_EQUALS(ratio, 0.5);
+        TS_ASSERT_EQUALS(optionO, argV[1]);
+    }
+
+    void testTokenChain_MissingResponseFile_Fail(void)
+    {
+        // Arrange
+        SmartOptionsTokenChain chain("SmartOptions");
+
+        // Act
+        SMARTOPTIONS_STATUS status = chain.AddResponseFile("SmartOptionsMissing.tmp");
+
+        // Assert
+        TS_ASSERT_EQUALS(status, SMARTOPTIONS_SYSTEM_ERROR);
+        TS_ASSERT_EQUALS(chain.Count(), 1);
+    }
+};
@@ -0,0 +1,22 @@
+/**
+ * @file        SmartOptionsTestPlugin.cpp
+ *
+ * @brief       A plugin, which exports its option table for the tests of PluginTableTest.h.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#include "SmartOptions/SmartOptions.hpp"
+
+#include "../CommonData.h"
+#include "SmartOptionsTestPlugin.h"
+
+static TestPluginConfig testPluginConfig = { TEST_PLUGIN_DEFAULT_LEVEL, TEST_PLUGIN_DEFAULT_RATIO, false };
+static constexpr SmartOptionsMember testPluginMembers[] = {
+    SMARTOPTIONS_MEMBER(TestPluginConfig, level, 'l', "level", "LEVEL", "The level"),
+    SMARTOPTIONS_MEMBER(TestPluginConfig, ratio, FLOAT_PREFIX_SHORT, FLOAT_PREFIX_LONG, FLOAT_META, FLOAT_HELP),
+    SMARTOPTIONS_MEMBER(TestPluginConfig, verbose, JSON_FLAG_SHORT, JSON_FLAG_LONG, NULL, JSON_FLAG_HELP),
+};
+
+SMARTOPTIONS_EXPORT_PLUGIN(PLUGIN_NAME, testPluginConfig, testPluginMembers)
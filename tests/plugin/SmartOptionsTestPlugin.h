@@ -0,0 +1,25 @@
+/**
+ * @file        SmartOptionsTestPlugin.h
+ *
+ * @brief       The struct of the test plugin.
+ *
+ * @details     The test plugin is built as a shared object from SmartOptionsTestPlugin.cpp, and loaded by the tests
+ * of PluginTableTest.h, which read its struct through the storage of its option table.
+ *
+ * @copyright   This content is released under Berkeley Software Distribution license (BSD).
+ *
+ */
+
+#ifndef SMARTOPTIONS_TEST_PLUGIN_H
+#define SMARTOPTIONS_TEST_PLUGIN_H
+
+#define TEST_PLUGIN_DEFAULT_LEVEL 7
+#define TEST_PLUGIN_DEFAULT_RATIO 1.0
+
+struct TestPluginConfig {
+    int level;
+    double ratio;
+    bool verbose;
+};
+
+#endif // SMARTOPTIONS_TEST_PLUGIN_H